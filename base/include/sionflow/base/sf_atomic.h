@@ -0,0 +1,244 @@
+#ifndef SF_ATOMIC_H
+#define SF_ATOMIC_H
+
+#include <sionflow/base/sf_platform.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * SionFlow Atomics
+ * Portable lock-free primitives with explicit memory ordering.
+ * Types (sf_atomic_i32, sf_atomic_i64, sf_atomic_ptr) are declared in sf_platform.h.
+ * All functions are inline so they compile down to single instructions.
+ */
+
+#define SF_CACHE_LINE_SIZE 64
+
+typedef enum {
+    SF_MEMORY_ORDER_RELAXED = 0,
+    SF_MEMORY_ORDER_ACQUIRE,
+    SF_MEMORY_ORDER_RELEASE,
+    SF_MEMORY_ORDER_ACQ_REL,
+    SF_MEMORY_ORDER_SEQ_CST
+} sf_memory_order;
+
+#ifdef _WIN32
+#include <intrin.h>
+
+// Interlocked* functions are full barriers, so every RMW is at least as
+// strong as requested. Plain loads/stores are fenced when ordering is needed.
+
+static inline void sf_atomic_thread_fence(sf_memory_order order) {
+    if (order != SF_MEMORY_ORDER_RELAXED) MemoryBarrier();
+}
+
+static inline void sf_cpu_relax(void) {
+    YieldProcessor();
+}
+
+// --- 32-bit ---
+
+static inline int32_t sf_atomic_load_i32(sf_atomic_i32* var, sf_memory_order order) {
+    int32_t v = *var;
+    if (order != SF_MEMORY_ORDER_RELAXED) MemoryBarrier();
+    return v;
+}
+
+static inline void sf_atomic_store_i32(sf_atomic_i32* var, int32_t val, sf_memory_order order) {
+    if (order == SF_MEMORY_ORDER_SEQ_CST) { InterlockedExchange(var, val); return; }
+    if (order != SF_MEMORY_ORDER_RELAXED) MemoryBarrier();
+    *var = val;
+}
+
+static inline int32_t sf_atomic_exchange_i32(sf_atomic_i32* var, int32_t val, sf_memory_order order) {
+    (void)order;
+    return InterlockedExchange(var, val);
+}
+
+static inline bool sf_atomic_cas_i32(sf_atomic_i32* var, int32_t* expected, int32_t desired, sf_memory_order success, sf_memory_order failure) {
+    (void)success; (void)failure;
+    int32_t prev = InterlockedCompareExchange(var, desired, *expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+}
+
+static inline int32_t sf_atomic_fetch_add_i32(sf_atomic_i32* var, int32_t val, sf_memory_order order) {
+    (void)order;
+    return InterlockedExchangeAdd(var, val);
+}
+
+// --- 64-bit ---
+
+static inline int64_t sf_atomic_load_i64(sf_atomic_i64* var, sf_memory_order order) {
+    int64_t v = *var;
+    if (order != SF_MEMORY_ORDER_RELAXED) MemoryBarrier();
+    return v;
+}
+
+static inline void sf_atomic_store_i64(sf_atomic_i64* var, int64_t val, sf_memory_order order) {
+    if (order == SF_MEMORY_ORDER_SEQ_CST) { InterlockedExchange64(var, val); return; }
+    if (order != SF_MEMORY_ORDER_RELAXED) MemoryBarrier();
+    *var = val;
+}
+
+static inline int64_t sf_atomic_exchange_i64(sf_atomic_i64* var, int64_t val, sf_memory_order order) {
+    (void)order;
+    return InterlockedExchange64(var, val);
+}
+
+static inline bool sf_atomic_cas_i64(sf_atomic_i64* var, int64_t* expected, int64_t desired, sf_memory_order success, sf_memory_order failure) {
+    (void)success; (void)failure;
+    int64_t prev = InterlockedCompareExchange64(var, desired, *expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+}
+
+static inline int64_t sf_atomic_fetch_add_i64(sf_atomic_i64* var, int64_t val, sf_memory_order order) {
+    (void)order;
+    return InterlockedExchangeAdd64(var, val);
+}
+
+// --- Pointer ---
+
+static inline void* sf_atomic_load_ptr(sf_atomic_ptr* var, sf_memory_order order) {
+    void* v = *var;
+    if (order != SF_MEMORY_ORDER_RELAXED) MemoryBarrier();
+    return v;
+}
+
+static inline void sf_atomic_store_ptr(sf_atomic_ptr* var, void* val, sf_memory_order order) {
+    if (order == SF_MEMORY_ORDER_SEQ_CST) { InterlockedExchangePointer(var, val); return; }
+    if (order != SF_MEMORY_ORDER_RELAXED) MemoryBarrier();
+    *var = val;
+}
+
+static inline void* sf_atomic_exchange_ptr(sf_atomic_ptr* var, void* val, sf_memory_order order) {
+    (void)order;
+    return InterlockedExchangePointer(var, val);
+}
+
+static inline bool sf_atomic_cas_ptr(sf_atomic_ptr* var, void** expected, void* desired, sf_memory_order success, sf_memory_order failure) {
+    (void)success; (void)failure;
+    void* prev = InterlockedCompareExchangePointer(var, desired, *expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+}
+
+#else
+
+static inline memory_order sf__memory_order(sf_memory_order order) {
+    switch (order) {
+        case SF_MEMORY_ORDER_RELAXED: return memory_order_relaxed;
+        case SF_MEMORY_ORDER_ACQUIRE: return memory_order_acquire;
+        case SF_MEMORY_ORDER_RELEASE: return memory_order_release;
+        case SF_MEMORY_ORDER_ACQ_REL: return memory_order_acq_rel;
+        default:                      return memory_order_seq_cst;
+    }
+}
+
+// Failure ordering of a CAS may not be release or acq_rel.
+static inline memory_order sf__memory_order_load(sf_memory_order order) {
+    if (order == SF_MEMORY_ORDER_RELEASE) return memory_order_relaxed;
+    if (order == SF_MEMORY_ORDER_ACQ_REL) return memory_order_acquire;
+    return sf__memory_order(order);
+}
+
+static inline void sf_atomic_thread_fence(sf_memory_order order) {
+    atomic_thread_fence(sf__memory_order(order));
+}
+
+static inline void sf_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// --- 32-bit ---
+
+static inline int32_t sf_atomic_load_i32(sf_atomic_i32* var, sf_memory_order order) {
+    return atomic_load_explicit(var, sf__memory_order_load(order));
+}
+
+static inline void sf_atomic_store_i32(sf_atomic_i32* var, int32_t val, sf_memory_order order) {
+    memory_order mo = sf__memory_order(order);
+    if (mo == memory_order_acquire || mo == memory_order_acq_rel) mo = memory_order_seq_cst;
+    atomic_store_explicit(var, val, mo);
+}
+
+static inline int32_t sf_atomic_exchange_i32(sf_atomic_i32* var, int32_t val, sf_memory_order order) {
+    return atomic_exchange_explicit(var, val, sf__memory_order(order));
+}
+
+static inline bool sf_atomic_cas_i32(sf_atomic_i32* var, int32_t* expected, int32_t desired, sf_memory_order success, sf_memory_order failure) {
+    int e = *expected;
+    bool ok = atomic_compare_exchange_strong_explicit(var, &e, desired, sf__memory_order(success), sf__memory_order_load(failure));
+    *expected = e;
+    return ok;
+}
+
+static inline int32_t sf_atomic_fetch_add_i32(sf_atomic_i32* var, int32_t val, sf_memory_order order) {
+    return atomic_fetch_add_explicit(var, val, sf__memory_order(order));
+}
+
+// --- 64-bit ---
+
+static inline int64_t sf_atomic_load_i64(sf_atomic_i64* var, sf_memory_order order) {
+    return atomic_load_explicit(var, sf__memory_order_load(order));
+}
+
+static inline void sf_atomic_store_i64(sf_atomic_i64* var, int64_t val, sf_memory_order order) {
+    memory_order mo = sf__memory_order(order);
+    if (mo == memory_order_acquire || mo == memory_order_acq_rel) mo = memory_order_seq_cst;
+    atomic_store_explicit(var, val, mo);
+}
+
+static inline int64_t sf_atomic_exchange_i64(sf_atomic_i64* var, int64_t val, sf_memory_order order) {
+    return atomic_exchange_explicit(var, val, sf__memory_order(order));
+}
+
+static inline bool sf_atomic_cas_i64(sf_atomic_i64* var, int64_t* expected, int64_t desired, sf_memory_order success, sf_memory_order failure) {
+    return atomic_compare_exchange_strong_explicit(var, expected, desired, sf__memory_order(success), sf__memory_order_load(failure));
+}
+
+static inline int64_t sf_atomic_fetch_add_i64(sf_atomic_i64* var, int64_t val, sf_memory_order order) {
+    return atomic_fetch_add_explicit(var, val, sf__memory_order(order));
+}
+
+// --- Pointer ---
+
+static inline void* sf_atomic_load_ptr(sf_atomic_ptr* var, sf_memory_order order) {
+    return atomic_load_explicit(var, sf__memory_order_load(order));
+}
+
+static inline void sf_atomic_store_ptr(sf_atomic_ptr* var, void* val, sf_memory_order order) {
+    memory_order mo = sf__memory_order(order);
+    if (mo == memory_order_acquire || mo == memory_order_acq_rel) mo = memory_order_seq_cst;
+    atomic_store_explicit(var, val, mo);
+}
+
+static inline void* sf_atomic_exchange_ptr(sf_atomic_ptr* var, void* val, sf_memory_order order) {
+    return atomic_exchange_explicit(var, val, sf__memory_order(order));
+}
+
+static inline bool sf_atomic_cas_ptr(sf_atomic_ptr* var, void** expected, void* desired, sf_memory_order success, sf_memory_order failure) {
+    return atomic_compare_exchange_strong_explicit(var, expected, desired, sf__memory_order(success), sf__memory_order_load(failure));
+}
+
+#endif
+
+// --- Derived Helpers ---
+
+static inline int32_t sf_atomic_fetch_sub_i32(sf_atomic_i32* var, int32_t val, sf_memory_order order) {
+    return sf_atomic_fetch_add_i32(var, -val, order);
+}
+
+static inline int64_t sf_atomic_fetch_sub_i64(sf_atomic_i64* var, int64_t val, sf_memory_order order) {
+    return sf_atomic_fetch_add_i64(var, -val, order);
+}
+
+#endif // SF_ATOMIC_H
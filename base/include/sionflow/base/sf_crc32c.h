@@ -0,0 +1,31 @@
+#ifndef SF_CRC32C_H
+#define SF_CRC32C_H
+
+#include <sionflow/base/sf_types.h>
+#include <stddef.h>
+
+/**
+ * SionFlow CRC32C (Castagnoli)
+ * Uses the SSE4.2 / ARMv8 CRC32 instructions when the CPU has them (three interleaved
+ * streams to hide the instruction latency), slicing-by-8 tables otherwise.
+ * All paths produce identical results.
+ */
+
+/**
+ * @brief Continues a CRC32C over 'size' bytes. Start with crc = 0.
+ * sf_crc32c(sf_crc32c(0, a, n), b, m) equals the CRC of a followed by b.
+ */
+u32 sf_crc32c(u32 crc, const void* data, size_t size);
+
+/**
+ * @brief CRC of A||B from crc(A), crc(B) and the length of B.
+ * Lets blocks of one buffer be checksummed independently (e.g. on a thread pool).
+ */
+u32 sf_crc32c_combine(u32 crc_a, u32 crc_b, size_t size_b);
+
+/**
+ * @brief True if sf_crc32c runs on hardware CRC instructions.
+ */
+bool sf_crc32c_hw_available(void);
+
+#endif // SF_CRC32C_H
@@ -0,0 +1,48 @@
+#ifndef SF_GEMM_H
+#define SF_GEMM_H
+
+#include <sionflow/base/sf_types.h>
+#include <sionflow/base/sf_math_batch.h>
+
+/**
+ * SionFlow GEMM
+ * Dense matrix products C = A * B over row-major f32 and i32 data, the building block
+ * behind MATMUL. Large products are split into cache blocks, packed into contiguous
+ * panels and run through register-tiled kernels picked once per machine (SSE2/NEON,
+ * AVX2, AVX-512); small or narrow products skip the packing.
+ *
+ * Each element is summed in ascending k: c[i][j] = ((a[i][0] * b[0][j] + a[i][1] * b[1][j]) + ...).
+ * Blocking, thread count and target never change the result, and f32 results equal that
+ * loop evaluated without FMA contraction. i32 products wrap around on overflow.
+ *
+ * lda, ldb and ldc are row strides in elements. C must not overlap A or B.
+ * Called on a pool worker, GEMM packs into a level of that worker's scratch stack
+ * (sf_thread_pool_scratch_acquire) and releases it before returning, so scratch the
+ * caller already holds stays valid.
+ * 'exec' is used as in sf_math_batch, except that min_parallel counts multiply-adds
+ * (m * n * k; 0 = SF_GEMM_DEFAULT_MIN_PARALLEL). Large products are split over tiles of
+ * C, batches over whole products.
+ */
+
+#define SF_GEMM_DEFAULT_MIN_PARALLEL (1u << 18) // Multiply-adds (64^3) below which work stays on the caller
+
+/**
+ * @brief C[m, n] = A[m, k] * B[k, n]. With k = 0, C is zeroed.
+ */
+void sf_gemm_f32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const f32* a, size_t lda, const f32* b, size_t ldb, f32* c, size_t ldc);
+void sf_gemm_i32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const i32* a, size_t lda, const i32* b, size_t ldb, i32* c, size_t ldc);
+
+/**
+ * @brief c[i] = a[i] * b[i] over 'count' contiguous products: a is [count, m, k],
+ * b [count, k, n] and c [count, m, n]. 3x3 and 4x4 f32 batches (UI and scene
+ * transforms) have dedicated kernels.
+ */
+void sf_gemm_batched_f32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const f32* a, const f32* b, f32* c, size_t count);
+void sf_gemm_batched_i32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const i32* a, const i32* b, i32* c, size_t count);
+
+/**
+ * @brief Name of the kernel set in use ("avx512", "avx2" or "baseline").
+ */
+const char* sf_gemm_target(void);
+
+#endif // SF_GEMM_H
@@ -0,0 +1,31 @@
+#ifndef SF_LZ_H
+#define SF_LZ_H
+
+#include <sionflow/base/sf_types.h>
+#include <stddef.h>
+
+/**
+ * SionFlow LZ Block Codec
+ * Byte-oriented LZ77 (LZ4-style sequences: token, literals, 16-bit offset, match).
+ * Blocks are independent, so chunks can be decoded concurrently. Decoding never
+ * reads or writes outside the given buffers, even on corrupt input.
+ */
+
+/**
+ * @brief Worst-case compressed size for 'src_size' input bytes.
+ */
+size_t sf_lz_compress_bound(size_t src_size);
+
+/**
+ * @brief Compresses one block.
+ * @return Compressed size, or 0 if dst_capacity is too small.
+ */
+size_t sf_lz_compress(const void* src, size_t src_size, void* dst, size_t dst_capacity);
+
+/**
+ * @brief Decompresses one block into exactly 'dst_size' bytes.
+ * @return false on malformed input or size mismatch.
+ */
+bool sf_lz_decompress(const void* src, size_t src_size, void* dst, size_t dst_size);
+
+#endif // SF_LZ_H
@@ -5,6 +5,23 @@
 #include <string.h>
 #include <sionflow/base/sf_types.h>
 
+// SIMD paths are chosen at compile time from the target ISA. Every path runs the
+// same per-lane sequence of IEEE multiplies and adds, so results are bit-identical
+// to the scalar fallback (as long as the compiler does not contract a * b + c into
+// FMA: the default for x86 builds; use -ffp-contract=off where FMA is baseline).
+// Define SF_MATH_SCALAR to force the fallback.
+#if !defined(SF_MATH_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define SF_MATH_SSE 1
+    #include <emmintrin.h>
+    #if defined(__AVX__)
+        #define SF_MATH_AVX 1
+        #include <immintrin.h>
+    #endif
+#elif !defined(SF_MATH_SCALAR) && defined(__ARM_NEON) && (defined(__GNUC__) || defined(__clang__))
+    #define SF_MATH_NEON 1
+    #include <arm_neon.h>
+#endif
+
 // --- Operations ---
 
 static inline sf_vec2 sf_vec2_add(sf_vec2 a, sf_vec2 b) {
@@ -36,6 +53,71 @@ static inline sf_vec3 sf_vec3_normalize(sf_vec3 v) {
     return (sf_vec3){0, 0, 0};
 }
 
+// --- 4-Lane Helpers (internal) ---
+
+#if defined(SF_MATH_SSE)
+typedef __m128 sf__f4;
+#define sf__f4_load(p)        _mm_loadu_ps(p)
+#define sf__f4_store(p, v)    _mm_storeu_ps((p), (v))
+#define sf__f4_splat(x)       _mm_set1_ps(x)
+#define sf__f4_set(a, b, c, d) _mm_setr_ps((a), (b), (c), (d))
+#define sf__f4_add(a, b)      _mm_add_ps((a), (b))
+#define sf__f4_sub(a, b)      _mm_sub_ps((a), (b))
+#define sf__f4_mul(a, b)      _mm_mul_ps((a), (b))
+// (a[i0], a[i1], b[i2], b[i3])
+#define sf__f4_shuffle2(a, b, i0, i1, i2, i3) _mm_shuffle_ps((a), (b), _MM_SHUFFLE(i3, i2, i1, i0))
+#elif defined(SF_MATH_NEON)
+typedef float32x4_t sf__f4;
+#define sf__f4_load(p)        vld1q_f32(p)
+#define sf__f4_store(p, v)    vst1q_f32((p), (v))
+#define sf__f4_splat(x)       vdupq_n_f32(x)
+#define sf__f4_set(a, b, c, d) ((float32x4_t){ (a), (b), (c), (d) })
+#define sf__f4_add(a, b)      vaddq_f32((a), (b))
+#define sf__f4_sub(a, b)      vsubq_f32((a), (b))
+#define sf__f4_mul(a, b)      vmulq_f32((a), (b))
+#if defined(__clang__)
+    #define sf__f4_shuffle2(a, b, i0, i1, i2, i3) __builtin_shufflevector((a), (b), i0, i1, (i2) + 4, (i3) + 4)
+#else
+    #define sf__f4_shuffle2(a, b, i0, i1, i2, i3) __builtin_shuffle((a), (b), (uint32x4_t){ i0, i1, (i2) + 4, (i3) + 4 })
+#endif
+#else
+typedef struct { f32 v[4]; } sf__f4;
+static inline sf__f4 sf__f4_load(const f32* p) { sf__f4 r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline void sf__f4_store(f32* p, sf__f4 a) { memcpy(p, a.v, sizeof(a.v)); }
+static inline sf__f4 sf__f4_splat(f32 x) { return (sf__f4){{ x, x, x, x }}; }
+static inline sf__f4 sf__f4_set(f32 a, f32 b, f32 c, f32 d) { return (sf__f4){{ a, b, c, d }}; }
+static inline sf__f4 sf__f4_add(sf__f4 a, sf__f4 b) { return (sf__f4){{ a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] }}; }
+static inline sf__f4 sf__f4_sub(sf__f4 a, sf__f4 b) { return (sf__f4){{ a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] }}; }
+static inline sf__f4 sf__f4_mul(sf__f4 a, sf__f4 b) { return (sf__f4){{ a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] }}; }
+#define sf__f4_shuffle2(a, b, i0, i1, i2, i3) ((sf__f4){{ (a).v[i0], (a).v[i1], (b).v[i2], (b).v[i3] }})
+#endif
+
+#define sf__f4_shuffle(a, i0, i1, i2, i3) sf__f4_shuffle2(a, a, i0, i1, i2, i3)
+
+// In-place 4x4 transpose of four lane vectors
+static inline void sf__f4_transpose(sf__f4* r0, sf__f4* r1, sf__f4* r2, sf__f4* r3) {
+#if defined(SF_MATH_SSE)
+    _MM_TRANSPOSE4_PS(*r0, *r1, *r2, *r3);
+#else
+    sf__f4 t0 = sf__f4_shuffle2(*r0, *r1, 0, 1, 0, 1); // a0 a1 b0 b1
+    sf__f4 t1 = sf__f4_shuffle2(*r0, *r1, 2, 3, 2, 3); // a2 a3 b2 b3
+    sf__f4 t2 = sf__f4_shuffle2(*r2, *r3, 0, 1, 0, 1); // c0 c1 d0 d1
+    sf__f4 t3 = sf__f4_shuffle2(*r2, *r3, 2, 3, 2, 3); // c2 c3 d2 d3
+    *r0 = sf__f4_shuffle2(t0, t2, 0, 2, 0, 2);
+    *r1 = sf__f4_shuffle2(t0, t2, 1, 3, 1, 3);
+    *r2 = sf__f4_shuffle2(t1, t3, 0, 2, 0, 2);
+    *r3 = sf__f4_shuffle2(t1, t3, 1, 3, 1, 3);
+#endif
+}
+
+// Sum of splat(s[k]) * cols[k], accumulated left to right
+static inline sf__f4 sf__f4_combine(const f32* s, sf__f4 c0, sf__f4 c1, sf__f4 c2, sf__f4 c3) {
+    sf__f4 r = sf__f4_mul(sf__f4_splat(s[0]), c0);
+    r = sf__f4_add(r, sf__f4_mul(sf__f4_splat(s[1]), c1));
+    r = sf__f4_add(r, sf__f4_mul(sf__f4_splat(s[2]), c2));
+    return sf__f4_add(r, sf__f4_mul(sf__f4_splat(s[3]), c3));
+}
+
 // --- Matrix 4x4 ---
 
 static inline sf_mat4 sf_mat4_identity(void) {
@@ -52,155 +134,111 @@ static inline sf_mat4 sf_mat4_translate(sf_vec3 v) {
     return res;
 }
 
+/**
+ * @brief res.m[i * 4 + j] = sum_k a.m[i * 4 + k] * b.m[k * 4 + j] (column-major: b * a).
+ */
 static inline sf_mat4 sf_mat4_mul(sf_mat4 a, sf_mat4 b) {
     sf_mat4 res;
+#if defined(SF_MATH_AVX)
+    // Two result columns per 256-bit operation
+    __m128 c0 = _mm_loadu_ps(&b.m[0]), c1 = _mm_loadu_ps(&b.m[4]), c2 = _mm_loadu_ps(&b.m[8]), c3 = _mm_loadu_ps(&b.m[12]);
+    __m256 b0 = _mm256_setr_m128(c0, c0), b1 = _mm256_setr_m128(c1, c1);
+    __m256 b2 = _mm256_setr_m128(c2, c2), b3 = _mm256_setr_m128(c3, c3);
+    for (int i = 0; i < 4; i += 2) {
+        const f32* s = &a.m[i * 4];
+        __m256 r = _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(s[0]), _mm_set1_ps(s[4])), b0);
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(s[1]), _mm_set1_ps(s[5])), b1));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(s[2]), _mm_set1_ps(s[6])), b2));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(s[3]), _mm_set1_ps(s[7])), b3));
+        _mm256_storeu_ps(&res.m[i * 4], r);
+    }
+#else
+    sf__f4 b0 = sf__f4_load(&b.m[0]), b1 = sf__f4_load(&b.m[4]), b2 = sf__f4_load(&b.m[8]), b3 = sf__f4_load(&b.m[12]);
     for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 4; j++) {
-            res.m[i * 4 + j] = 0;
-            for (int k = 0; k < 4; k++) {
-                res.m[i * 4 + j] += a.m[i * 4 + k] * b.m[k * 4 + j];
-            }
-        }
+        sf__f4_store(&res.m[i * 4], sf__f4_combine(&a.m[i * 4], b0, b1, b2, b3));
     }
+#endif
     return res;
 }
 
+/**
+ * @brief m * v (column vector), so sf_mat4_translate moves points with w = 1.
+ */
+static inline sf_vec4 sf_mat4_mul_vec4(sf_mat4 m, sf_vec4 v) {
+    f32 s[4] = { v.x, v.y, v.z, v.w };
+    f32 r[4];
+    sf__f4_store(r, sf__f4_combine(s, sf__f4_load(&m.m[0]), sf__f4_load(&m.m[4]), sf__f4_load(&m.m[8]), sf__f4_load(&m.m[12])));
+    return (sf_vec4){ r[0], r[1], r[2], r[3] };
+}
+
 static inline sf_mat4 sf_mat4_transpose(sf_mat4 m) {
+    sf__f4 r0 = sf__f4_load(&m.m[0]), r1 = sf__f4_load(&m.m[4]), r2 = sf__f4_load(&m.m[8]), r3 = sf__f4_load(&m.m[12]);
+    sf__f4_transpose(&r0, &r1, &r2, &r3);
     sf_mat4 res;
-    for(int c=0; c<4; ++c) {
-        for(int r=0; r<4; ++r) {
-            res.m[c*4+r] = m.m[r*4+c];
-        }
-    }
+    sf__f4_store(&res.m[0], r0);
+    sf__f4_store(&res.m[4], r1);
+    sf__f4_store(&res.m[8], r2);
+    sf__f4_store(&res.m[12], r3);
     return res;
 }
 
-// Minimal implementation of 4x4 inverse using cofactor expansion
+/**
+ * @brief Inverse via 2x2 sub-determinants (adjugate / det), in single precision.
+ * Returns the identity for singular matrices.
+ */
 static inline sf_mat4 sf_mat4_inverse(sf_mat4 m) {
-    f32 inv[16];
-    f32 det;
-    f32* mat = m.m;
-
-    inv[0] = mat[5]  * mat[10] * mat[15] - 
-             mat[5]  * mat[11] * mat[14] - 
-             mat[9]  * mat[6]  * mat[15] + 
-             mat[9]  * mat[7]  * mat[14] +
-             mat[13] * mat[6]  * mat[11] - 
-             mat[13] * mat[7]  * mat[10];
-
-    inv[4] = -mat[4]  * mat[10] * mat[15] + 
-              mat[4]  * mat[11] * mat[14] + 
-              mat[8]  * mat[6]  * mat[15] - 
-              mat[8]  * mat[7]  * mat[14] - 
-              mat[12] * mat[6]  * mat[11] + 
-              mat[12] * mat[7]  * mat[10];
-
-    inv[8] = mat[4]  * mat[9] * mat[15] - 
-             mat[4]  * mat[11] * mat[13] - 
-             mat[8]  * mat[5] * mat[15] + 
-             mat[8]  * mat[7] * mat[13] + 
-             mat[12] * mat[5] * mat[11] - 
-             mat[12] * mat[7] * mat[9];
-
-    inv[12] = -mat[4]  * mat[9] * mat[14] + 
-               mat[4]  * mat[10] * mat[13] +
-               mat[8]  * mat[5] * mat[14] - 
-               mat[8]  * mat[6] * mat[13] - 
-               mat[12] * mat[5] * mat[10] + 
-               mat[12] * mat[6] * mat[9];
-
-    inv[1] = -mat[1]  * mat[10] * mat[15] + 
-              mat[1]  * mat[11] * mat[14] + 
-              mat[9]  * mat[2] * mat[15] - 
-              mat[9]  * mat[3] * mat[14] - 
-              mat[13] * mat[2] * mat[11] + 
-              mat[13] * mat[3] * mat[10];
-
-    inv[5] = mat[0]  * mat[10] * mat[15] - 
-             mat[0]  * mat[11] * mat[14] - 
-             mat[8]  * mat[2] * mat[15] + 
-             mat[8]  * mat[3] * mat[14] + 
-             mat[12] * mat[2] * mat[11] - 
-             mat[12] * mat[3] * mat[10];
-
-    inv[9] = -mat[0]  * mat[9] * mat[15] + 
-              mat[0]  * mat[11] * mat[13] + 
-              mat[8]  * mat[1] * mat[15] - 
-              mat[8]  * mat[3] * mat[13] - 
-              mat[12] * mat[1] * mat[11] + 
-              mat[12] * mat[3] * mat[9];
-
-    inv[13] = mat[0]  * mat[9] * mat[14] - 
-              mat[0]  * mat[10] * mat[13] - 
-              mat[8]  * mat[1] * mat[14] + 
-              mat[8]  * mat[2] * mat[13] + 
-              mat[12] * mat[1] * mat[10] - 
-              mat[12] * mat[2] * mat[9];
-
-    inv[2] = mat[1]  * mat[6] * mat[15] - 
-             mat[1]  * mat[7] * mat[14] - 
-             mat[5]  * mat[2] * mat[15] + 
-             mat[5]  * mat[3] * mat[14] + 
-             mat[13] * mat[2] * mat[7] - 
-             mat[13] * mat[3] * mat[6];
-
-    inv[6] = -mat[0]  * mat[6] * mat[15] + 
-              mat[0]  * mat[7] * mat[14] + 
-              mat[4]  * mat[2] * mat[15] - 
-              mat[4]  * mat[3] * mat[14] - 
-              mat[12] * mat[2] * mat[7] + 
-              mat[12] * mat[3] * mat[6];
-
-    inv[10] = mat[0]  * mat[5] * mat[15] - 
-              mat[0]  * mat[7] * mat[13] - 
-              mat[4]  * mat[1] * mat[15] + 
-              mat[4]  * mat[3] * mat[13] + 
-              mat[12] * mat[1] * mat[7] - 
-              mat[12] * mat[3] * mat[5];
-
-    inv[14] = -mat[0]  * mat[5] * mat[14] + 
-               mat[0]  * mat[6] * mat[13] + 
-               mat[4]  * mat[1] * mat[14] - 
-               mat[4]  * mat[2] * mat[13] - 
-               mat[12] * mat[1] * mat[6] + 
-               mat[12] * mat[2] * mat[5];
-
-    inv[3] = -mat[1] * mat[6] * mat[11] + 
-              mat[1] * mat[7] * mat[10] + 
-              mat[5] * mat[2] * mat[11] - 
-              mat[5] * mat[3] * mat[10] - 
-              mat[9] * mat[2] * mat[7] + 
-              mat[9] * mat[3] * mat[6];
-
-    inv[7] = mat[0] * mat[6] * mat[11] - 
-             mat[0] * mat[7] * mat[10] - 
-             mat[4] * mat[2] * mat[11] + 
-             mat[4] * mat[3] * mat[10] + 
-             mat[8] * mat[2] * mat[7] - 
-             mat[8] * mat[3] * mat[6];
-
-    inv[11] = -mat[0] * mat[5] * mat[11] + 
-               mat[0] * mat[7] * mat[9] + 
-               mat[4] * mat[1] * mat[11] - 
-               mat[4] * mat[3] * mat[9] - 
-               mat[8] * mat[1] * mat[7] + 
-               mat[8] * mat[3] * mat[5];
-
-    inv[15] = mat[0] * mat[5] * mat[10] - 
-              mat[0] * mat[6] * mat[9] - 
-              mat[4] * mat[1] * mat[10] + 
-              mat[4] * mat[2] * mat[9] + 
-              mat[8] * mat[1] * mat[6] - 
-              mat[8] * mat[2] * mat[5];
-
-    det = mat[0] * inv[0] + mat[1] * inv[4] + mat[2] * inv[8] + mat[3] * inv[12];
+    // Rows r[i] = (a_i0, a_i1, a_i2, a_i3) with a_ij = m.m[i * 4 + j]. The formula is
+    // layout-agnostic: inverting the transpose yields the transposed inverse.
+    sf__f4 r0 = sf__f4_load(&m.m[0]), r1 = sf__f4_load(&m.m[4]), r2 = sf__f4_load(&m.m[8]), r3 = sf__f4_load(&m.m[12]);
+
+    // s = (s0, s1, s2, s3), c = (c0, c1, c2, c3), e = (s4, s5, c4, c5) where for column pairs
+    // (0,1) (0,2) (0,3) (1,2) (1,3) (2,3): s_k = a0i*a1j - a1i*a0j and c_k = a2i*a3j - a3i*a2j
+    sf__f4 s = sf__f4_sub(sf__f4_mul(sf__f4_shuffle(r0, 0, 0, 0, 1), sf__f4_shuffle(r1, 1, 2, 3, 2)),
+                          sf__f4_mul(sf__f4_shuffle(r1, 0, 0, 0, 1), sf__f4_shuffle(r0, 1, 2, 3, 2)));
+    sf__f4 c = sf__f4_sub(sf__f4_mul(sf__f4_shuffle(r2, 0, 0, 0, 1), sf__f4_shuffle(r3, 1, 2, 3, 2)),
+                          sf__f4_mul(sf__f4_shuffle(r3, 0, 0, 0, 1), sf__f4_shuffle(r2, 1, 2, 3, 2)));
+    sf__f4 e = sf__f4_sub(sf__f4_mul(sf__f4_shuffle2(r0, r2, 1, 2, 1, 2), sf__f4_shuffle2(r1, r3, 3, 3, 3, 3)),
+                          sf__f4_mul(sf__f4_shuffle2(r1, r3, 1, 2, 1, 2), sf__f4_shuffle2(r0, r2, 3, 3, 3, 3)));
+
+    // d_k = (c_k, c_k, s_k, s_k)
+    sf__f4 d0 = sf__f4_shuffle2(c, s, 0, 0, 0, 0);
+    sf__f4 d1 = sf__f4_shuffle2(c, s, 1, 1, 1, 1);
+    sf__f4 d2 = sf__f4_shuffle2(c, s, 2, 2, 2, 2);
+    sf__f4 d3 = sf__f4_shuffle2(c, s, 3, 3, 3, 3);
+    sf__f4 d4 = sf__f4_shuffle(e, 2, 2, 0, 0);
+    sf__f4 d5 = sf__f4_shuffle(e, 3, 3, 1, 1);
+
+    // k_j = (a1j, a0j, a3j, a2j)
+    sf__f4 k0 = r0, k1 = r1, k2 = r2, k3 = r3;
+    sf__f4_transpose(&k0, &k1, &k2, &k3);
+    k0 = sf__f4_shuffle(k0, 1, 0, 3, 2);
+    k1 = sf__f4_shuffle(k1, 1, 0, 3, 2);
+    k2 = sf__f4_shuffle(k2, 1, 0, 3, 2);
+    k3 = sf__f4_shuffle(k3, 1, 0, 3, 2);
+
+    sf__f4 even = sf__f4_set(1.0f, -1.0f, 1.0f, -1.0f);
+    sf__f4 odd = sf__f4_set(-1.0f, 1.0f, -1.0f, 1.0f);
+    sf__f4 b0 = sf__f4_mul(sf__f4_add(sf__f4_sub(sf__f4_mul(k1, d5), sf__f4_mul(k2, d4)), sf__f4_mul(k3, d3)), even);
+    sf__f4 b1 = sf__f4_mul(sf__f4_add(sf__f4_sub(sf__f4_mul(k0, d5), sf__f4_mul(k2, d2)), sf__f4_mul(k3, d1)), odd);
+    sf__f4 b2 = sf__f4_mul(sf__f4_add(sf__f4_sub(sf__f4_mul(k0, d4), sf__f4_mul(k1, d2)), sf__f4_mul(k3, d0)), even);
+    sf__f4 b3 = sf__f4_mul(sf__f4_add(sf__f4_sub(sf__f4_mul(k0, d3), sf__f4_mul(k1, d1)), sf__f4_mul(k2, d0)), odd);
+
+    // det = row 0 of m . column 0 of the adjugate (lane 0 of b0..b3)
+    f32 l0[4], l1[4], l2[4], l3[4];
+    sf__f4_store(l0, b0);
+    sf__f4_store(l1, b1);
+    sf__f4_store(l2, b2);
+    sf__f4_store(l3, b3);
+    f32 det = (m.m[0] * l0[0] + m.m[1] * l1[0]) + (m.m[2] * l2[0] + m.m[3] * l3[0]);
 
     if (det == 0) return sf_mat4_identity();
 
-    det = 1.0 / det;
-
+    sf__f4 inv_det = sf__f4_splat(1.0f / det);
     sf_mat4 res;
-    for (int i = 0; i < 16; i++) res.m[i] = inv[i] * det;
+    sf__f4_store(&res.m[0], sf__f4_mul(b0, inv_det));
+    sf__f4_store(&res.m[4], sf__f4_mul(b1, inv_det));
+    sf__f4_store(&res.m[8], sf__f4_mul(b2, inv_det));
+    sf__f4_store(&res.m[12], sf__f4_mul(b3, inv_det));
     return res;
 }
 
@@ -212,56 +250,93 @@ static inline sf_mat3 sf_mat3_identity(void) {
     return res;
 }
 
+// Columns of a 3x3 matrix padded to 4 lanes (lane 3 = 0)
+static inline sf__f4 sf__f4_load3(const f32* p) {
+    return sf__f4_set(p[0], p[1], p[2], 0.0f);
+}
+
+/**
+ * @brief res.m[i * 3 + j] = sum_k a.m[i * 3 + k] * b.m[k * 3 + j] (column-major: b * a).
+ */
 static inline sf_mat3 sf_mat3_mul(sf_mat3 a, sf_mat3 b) {
-    sf_mat3 res;
+    sf__f4 b0 = sf__f4_load3(&b.m[0]), b1 = sf__f4_load3(&b.m[3]), b2 = sf__f4_load3(&b.m[6]);
+    f32 out[12];
     for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            res.m[i * 3 + j] = 0;
-            for (int k = 0; k < 3; k++) {
-                res.m[i * 3 + j] += a.m[i * 3 + k] * b.m[k * 3 + j];
-            }
-        }
+        const f32* s = &a.m[i * 3];
+        sf__f4 r = sf__f4_mul(sf__f4_splat(s[0]), b0);
+        r = sf__f4_add(r, sf__f4_mul(sf__f4_splat(s[1]), b1));
+        r = sf__f4_add(r, sf__f4_mul(sf__f4_splat(s[2]), b2));
+        sf__f4_store(&out[i * 4], r);
     }
+    sf_mat3 res;
+    for (int i = 0; i < 3; i++) memcpy(&res.m[i * 3], &out[i * 4], 3 * sizeof(f32));
     return res;
 }
 
-static inline sf_mat3 sf_mat3_transpose(sf_mat3 m) {
+/**
+ * @brief m * v (column vector).
+ */
+static inline sf_vec3 sf_mat3_mul_vec3(sf_mat3 m, sf_vec3 v) {
+    sf__f4 r = sf__f4_mul(sf__f4_splat(v.x), sf__f4_load3(&m.m[0]));
+    r = sf__f4_add(r, sf__f4_mul(sf__f4_splat(v.y), sf__f4_load3(&m.m[3])));
+    r = sf__f4_add(r, sf__f4_mul(sf__f4_splat(v.z), sf__f4_load3(&m.m[6])));
+    f32 out[4];
+    sf__f4_store(out, r);
+    return (sf_vec3){ out[0], out[1], out[2] };
+}
+
+// Stores lanes 0..2 of each column into a 3x3 matrix
+static inline sf_mat3 sf__mat3_store(sf__f4 c0, sf__f4 c1, sf__f4 c2) {
+    f32 out[12];
+    sf__f4_store(&out[0], c0);
+    sf__f4_store(&out[4], c1);
+    sf__f4_store(&out[8], c2);
     sf_mat3 res;
-    for(int c=0; c<3; ++c) {
-        for(int r=0; r<3; ++r) {
-            res.m[c*3+r] = m.m[r*3+c];
-        }
-    }
+    for (int i = 0; i < 3; i++) memcpy(&res.m[i * 3], &out[i * 4], 3 * sizeof(f32));
     return res;
 }
 
+static inline sf_mat3 sf_mat3_transpose(sf_mat3 m) {
+    sf__f4 c0 = sf__f4_load3(&m.m[0]), c1 = sf__f4_load3(&m.m[3]), c2 = sf__f4_load3(&m.m[6]);
+    sf__f4 c3 = sf__f4_splat(0.0f);
+    sf__f4_transpose(&c0, &c1, &c2, &c3);
+    return sf__mat3_store(c0, c1, c2);
+}
+
 static inline f32 sf_mat3_det(sf_mat3 m) {
     return m.m[0] * (m.m[4] * m.m[8] - m.m[5] * m.m[7]) -
            m.m[3] * (m.m[1] * m.m[8] - m.m[2] * m.m[7]) +
            m.m[6] * (m.m[1] * m.m[5] - m.m[2] * m.m[4]);
 }
 
+// a x b over lanes 0..2 (lane 3 stays 0 for padded inputs)
+static inline sf__f4 sf__f4_cross3(sf__f4 a, sf__f4 b) {
+    return sf__f4_sub(sf__f4_mul(sf__f4_shuffle(a, 1, 2, 0, 3), sf__f4_shuffle(b, 2, 0, 1, 3)),
+                      sf__f4_mul(sf__f4_shuffle(a, 2, 0, 1, 3), sf__f4_shuffle(b, 1, 2, 0, 3)));
+}
+
+/**
+ * @brief Inverse as the transposed cross products of the columns over the determinant.
+ * Returns the identity for (nearly) singular matrices.
+ */
 static inline sf_mat3 sf_mat3_inverse(sf_mat3 m) {
-    f32 det = sf_mat3_det(m);
+    sf__f4 c0 = sf__f4_load3(&m.m[0]), c1 = sf__f4_load3(&m.m[3]), c2 = sf__f4_load3(&m.m[6]);
+    sf__f4 x0 = sf__f4_cross3(c1, c2);
+    sf__f4 x1 = sf__f4_cross3(c2, c0);
+    sf__f4 x2 = sf__f4_cross3(c0, c1);
+
+    // Same value as sf_mat3_det: expansion along the first row
+    f32 k0[4], k1[4], k2[4];
+    sf__f4_store(k0, x0);
+    sf__f4_store(k1, x1);
+    sf__f4_store(k2, x2);
+    f32 det = m.m[0] * k0[0] + m.m[3] * k1[0] + m.m[6] * k2[0];
     if (fabsf(det) < 1e-6f) return sf_mat3_identity(); // Fallback
-    f32 invDet = 1.0f / det;
-    
-    sf_mat3 res;
-    // Adjugate matrix / det (Transposed Cofactors)
-    // 00 -> +(44*88 - 55*77)
-    res.m[0] = (m.m[4] * m.m[8] - m.m[5] * m.m[7]) * invDet;
-    // 10 -> -(10*88 - 20*70) -> 01 of original
-    res.m[1] = (m.m[2] * m.m[7] - m.m[1] * m.m[8]) * invDet;
-    res.m[2] = (m.m[1] * m.m[5] - m.m[2] * m.m[4]) * invDet;
-    
-    res.m[3] = (m.m[5] * m.m[6] - m.m[3] * m.m[8]) * invDet;
-    res.m[4] = (m.m[0] * m.m[8] - m.m[2] * m.m[6]) * invDet;
-    res.m[5] = (m.m[2] * m.m[3] - m.m[0] * m.m[5]) * invDet;
-    
-    res.m[6] = (m.m[3] * m.m[7] - m.m[4] * m.m[6]) * invDet;
-    res.m[7] = (m.m[1] * m.m[6] - m.m[0] * m.m[7]) * invDet;
-    res.m[8] = (m.m[0] * m.m[4] - m.m[1] * m.m[3]) * invDet;
-    return res;
+
+    sf__f4 x3 = sf__f4_splat(0.0f);
+    sf__f4_transpose(&x0, &x1, &x2, &x3);
+    sf__f4 inv_det = sf__f4_splat(1.0f / det);
+    return sf__mat3_store(sf__f4_mul(x0, inv_det), sf__f4_mul(x1, inv_det), sf__f4_mul(x2, inv_det));
 }
 
 #endif // SF_MATH_H
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef SF_MATH_BATCH_H
+#define SF_MATH_BATCH_H
+
+#include <sionflow/base/sf_types.h>
+#include <sionflow/base/sf_thread_pool.h>
+
+/**
+ * SionFlow Batched Math
+ * Stream versions of sf_math over contiguous f32 data. Vectors are structure-of-arrays
+ * (x[i], y[i], z[i] in separate arrays), matrices are [N, 4, 4] arrays of sf_mat4
+ * layout. Kernels are picked once per machine (SSE2/AVX2/AVX-512/NEON) and every lane
+ * runs the same IEEE operations as the sf_math routine it mirrors, so results match
+ * calling sf_math per element bit for bit (only the payload of NaN results may differ).
+ *
+ * Outputs may alias the matching input (in-place), but not a different input array.
+ */
+
+typedef struct {
+    f32* x;
+    f32* y;
+    f32* z;
+} sf_soa3;
+
+#define SF_MATH_BATCH_DEFAULT_MIN_PARALLEL 65536 // Elements below which work stays on the caller
+
+/**
+ * @brief Where a batch runs. Pass NULL to run on the calling thread.
+ */
+typedef struct {
+    sf_thread_pool* pool;  // Optional. Splits large batches across its workers.
+    size_t min_parallel;   // 0 = SF_MATH_BATCH_DEFAULT_MIN_PARALLEL
+} sf_math_batch_exec;
+
+/**
+ * @brief out[i] = m * (in[i], 1) (sf_mat4_mul_vec4 with w = 1, w of the result dropped).
+ */
+void sf_batch_transform_points(const sf_math_batch_exec* exec, const sf_mat4* m, sf_soa3 in, sf_soa3 out, size_t count);
+
+/**
+ * @brief out[i] = m * (in[i], 0). For normals pass the inverse transpose of the model matrix.
+ */
+void sf_batch_transform_dirs(const sf_math_batch_exec* exec, const sf_mat4* m, sf_soa3 in, sf_soa3 out, size_t count);
+
+/**
+ * @brief sf_vec3_normalize per element (zero-length vectors become 0).
+ */
+void sf_batch_normalize3(const sf_math_batch_exec* exec, sf_soa3 in, sf_soa3 out, size_t count);
+
+void sf_batch_dot3(const sf_math_batch_exec* exec, sf_soa3 a, sf_soa3 b, f32* out, size_t count);
+void sf_batch_cross3(const sf_math_batch_exec* exec, sf_soa3 a, sf_soa3 b, sf_soa3 out, size_t count);
+void sf_batch_length3(const sf_math_batch_exec* exec, sf_soa3 in, f32* out, size_t count);
+
+/**
+ * @brief out[i] = sf_mat4_mul(a[i], b[i]) over [count, 4, 4] arrays.
+ */
+void sf_batch_mat4_mul(const sf_math_batch_exec* exec, const f32* a, const f32* b, f32* out, size_t count);
+
+/**
+ * @brief out[i] = sf_mat4_inverse(in[i]) over [count, 4, 4] arrays.
+ */
+void sf_batch_mat4_inverse(const sf_math_batch_exec* exec, const f32* in, f32* out, size_t count);
+
+/**
+ * @brief Name of the kernel set in use ("avx512", "avx2" or "baseline").
+ */
+const char* sf_math_batch_target(void);
+
+#endif // SF_MATH_BATCH_H
@@ -16,6 +16,10 @@
     
     // Simple atomic for counter
     typedef volatile LONG sf_atomic_i32;
+    typedef volatile LONG64 sf_atomic_i64;
+    typedef void* volatile sf_atomic_ptr;
+
+    #include <intrin.h>
 
 #else
     #include <pthread.h>
@@ -27,6 +31,8 @@
     typedef pthread_cond_t sf_cond_t;
     
     typedef atomic_int sf_atomic_i32;
+    typedef _Atomic int64_t sf_atomic_i64;
+    typedef _Atomic(void*) sf_atomic_ptr;
 #endif
 
 // Thread Function Prototype
@@ -51,10 +57,215 @@ void sf_cond_broadcast(sf_cond_t* cond);
 void sf_cond_destroy(sf_cond_t* cond);
 
 // --- Atomic API ---
+// Sequentially consistent 32-bit helpers. See sf_atomic.h for CAS, 64-bit,
+// pointer variants and explicit memory ordering.
 int32_t sf_atomic_inc(sf_atomic_i32* var);
 int32_t sf_atomic_load(sf_atomic_i32* var);
 void sf_atomic_store(sf_atomic_i32* var, int32_t val);
 
+// --- Time API ---
+
+/**
+ * Monotonic clock in nanoseconds. The epoch is arbitrary (boot or process start),
+ * so only differences between two readings are meaningful.
+ */
+uint64_t sf_time_now_ns(void);
+
+/**
+ * Raw CPU cycle counter: TSC on x86, CNTVCT_EL0 on AArch64.
+ * Cheaper than sf_time_now_ns but not serializing; use for short hot sections.
+ * Falls back to sf_time_now_ns on other architectures (frequency 1 GHz).
+ */
+static inline uint64_t sf_cycles_now(void) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t v;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return sf_time_now_ns();
+#endif
+}
+
+/**
+ * Ticks per second of sf_cycles_now. Calibrated against sf_time_now_ns on the
+ * first call (a few milliseconds), cached afterwards.
+ */
+uint64_t sf_cycles_frequency(void);
+
+/**
+ * Converts a cycle delta to nanoseconds using sf_cycles_frequency.
+ */
+uint64_t sf_cycles_to_ns(uint64_t cycles);
+
+// --- Scoped Timer ---
+
+typedef struct sf_timer {
+    uint64_t start_ns;
+} sf_timer;
+
+static inline void sf_timer_start(sf_timer* timer) {
+    timer->start_ns = sf_time_now_ns();
+}
+
+static inline uint64_t sf_timer_elapsed_ns(const sf_timer* timer) {
+    return sf_time_now_ns() - timer->start_ns;
+}
+
+/**
+ * Adds the duration of the following statement/block to 'accum_ns' (uint64_t lvalue).
+ * Usage: SF_TIME_BLOCK(stats.exec_ns) { run(); }
+ * Leaving the block with break/return/goto skips the accumulation.
+ */
+#define SF_TIME_BLOCK(accum_ns) \
+    for (uint64_t sf__tb_start = sf_time_now_ns(), sf__tb_once = 1; sf__tb_once; \
+         sf__tb_once = 0, (accum_ns) += sf_time_now_ns() - sf__tb_start)
+
+// --- File Mapping API ---
+
+typedef enum {
+    SF_FILE_MAP_ADVICE_NORMAL = 0,
+    SF_FILE_MAP_ADVICE_SEQUENTIAL,  // Aggressive read-ahead
+    SF_FILE_MAP_ADVICE_RANDOM,      // No read-ahead
+    SF_FILE_MAP_ADVICE_WILLNEED,    // Start paging in now
+    SF_FILE_MAP_ADVICE_DONTNEED     // Pages may be dropped (re-read on next touch)
+} sf_file_map_advice;
+
+/**
+ * Read-only view of a whole file. Pages are faulted in on first touch,
+ * so resident memory only grows with what is actually read.
+ */
+typedef struct sf_file_map {
+    const void* data;   // NULL for empty files
+    size_t size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} sf_file_map;
+
+/**
+ * Maps 'path' read-only. Zero-length files succeed with data == NULL.
+ * Returns false if the file cannot be opened or mapped.
+ */
+bool sf_file_map_open(sf_file_map* map, const char* path, sf_file_map_advice advice);
+
+/**
+ * Applies an access hint to a byte range of the mapping (rounded out to pages).
+ * Best effort: a no-op where the OS has no equivalent.
+ */
+void sf_file_map_advise(const sf_file_map* map, size_t offset, size_t size, sf_file_map_advice advice);
+
+/**
+ * Unmaps the view. Pointers into map->data become invalid.
+ */
+void sf_file_map_close(sf_file_map* map);
+
+// --- Executable Memory API ---
+
+/**
+ * Allocates whole pages for generated code, initially read/write.
+ * Code must be sealed with sf_exec_mem_seal before it is called (W^X: never
+ * writable and executable at once). Returns NULL on failure.
+ */
+void* sf_exec_mem_alloc(size_t size);
+
+/**
+ * Makes pages from sf_exec_mem_alloc read/execute-only and flushes the instruction cache.
+ */
+bool sf_exec_mem_seal(void* ptr, size_t size);
+
+void sf_exec_mem_free(void* ptr, size_t size);
+
+// --- CPU Features API ---
+
+// CPU Feature Bits (x86)
+#define SF_CPU_SSE2        (1u << 0)
+#define SF_CPU_SSE41       (1u << 1)
+#define SF_CPU_SSE42       (1u << 2)
+#define SF_CPU_AVX         (1u << 3)
+#define SF_CPU_AVX2        (1u << 4)
+#define SF_CPU_FMA         (1u << 5)
+#define SF_CPU_F16C        (1u << 6)
+#define SF_CPU_AVX512F     (1u << 7)
+#define SF_CPU_AVX512BW    (1u << 8)
+#define SF_CPU_AVX512VL    (1u << 9)
+
+// CPU Feature Bits (AArch64)
+#define SF_CPU_NEON        (1u << 16)
+#define SF_CPU_ARM_CRC32   (1u << 17)
+#define SF_CPU_ARM_FP16    (1u << 18) // Half precision arithmetic (FPHP + ASIMDHP)
+#define SF_CPU_ARM_DOTPROD (1u << 19)
+
+/**
+ * Features of the running CPU (SF_CPU_*), from CPUID/XGETBV on x86 and HWCAP or
+ * the OS on AArch64. AVX and AVX-512 are only reported when the OS saves their
+ * register state. Detected on first call and cached; restricted by sf_cpu_set_feature_mask.
+ */
+uint32_t sf_cpu_features(void);
+
+/**
+ * True if every bit of 'features' is available.
+ */
+static inline bool sf_cpu_has(uint32_t features) {
+    return (sf_cpu_features() & features) == features;
+}
+
+/**
+ * Hides features from sf_cpu_features (e.g. to test fallback paths or pin a
+ * deployment to a common subset). Call before kernels are selected: tables
+ * already chosen by sf_cpu_select keep their variant. Pass ~0u to reset.
+ */
+void sf_cpu_set_feature_mask(uint32_t mask);
+
+/**
+ * Lower-case name of a single feature bit ("avx2"), or NULL.
+ */
+const char* sf_cpu_feature_name(uint32_t feature);
+
+// --- Kernel Dispatch ---
+
+/**
+ * One build of a function table. 'table' points to a struct of function pointers
+ * compiled for the 'required' features (usually in a per-target compilation unit,
+ * see sf_add_multiversion in cmake/SFMultiversion.cmake).
+ */
+typedef struct {
+    uint32_t required; // SF_CPU_* bits
+    const void* table;
+} sf_cpu_variant;
+
+/**
+ * Returns the table of the first variant whose requirements are met. List variants
+ * best-first and end with a baseline (required = 0). Callers select once (e.g. on
+ * first use) and keep the pointer, so dispatch is a single indirect call.
+ */
+const void* sf_cpu_select(const sf_cpu_variant* variants, uint32_t count);
+
+/**
+ * sf_cpu_select remembered in '*cache' (zero-initialized): the first call selects and
+ * stores the table, later calls are a single acquire load. Threads racing on the first
+ * call select the same table.
+ */
+const void* sf_cpu_select_cached(sf_atomic_ptr* cache, const sf_cpu_variant* variants, uint32_t count);
+
+// 'required' bits of the x86 sf_add_multiversion targets
+#define SF_CPU_VARIANT_AVX2   (SF_CPU_AVX2 | SF_CPU_FMA | SF_CPU_F16C)
+#define SF_CPU_VARIANT_AVX512 (SF_CPU_AVX512F | SF_CPU_AVX512BW | SF_CPU_AVX512VL | SF_CPU_VARIANT_AVX2)
+
+// Per-target units are compiled with SF_TARGET_NAME set to the target (e.g. avx2).
+// SF_TARGET_SYMBOL(name) gives their exported symbols distinct names (name_avx2).
+#define SF__TARGET_CAT2(a, b) a##_##b
+#define SF__TARGET_CAT(a, b) SF__TARGET_CAT2(a, b)
+#ifdef SF_TARGET_NAME
+    #define SF_TARGET_SYMBOL(name) SF__TARGET_CAT(name, SF_TARGET_NAME)
+#else
+    #define SF_TARGET_SYMBOL(name) name
+#endif
+
 // --- File System API ---
 
 /**
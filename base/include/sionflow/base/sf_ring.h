@@ -0,0 +1,83 @@
+#ifndef SF_RING_H
+#define SF_RING_H
+
+#include <sionflow/base/sf_types.h>
+#include <sionflow/base/sf_atomic.h>
+
+/**
+ * SionFlow Lock-Free Ring Buffers
+ * Bounded queues of fixed-size elements over a caller-provided backing buffer.
+ * Capacity must be a power of two. Elements are copied in and out (memcpy).
+ */
+
+// --- SPSC (Single Producer / Single Consumer) ---
+
+typedef struct sf_spsc_ring {
+    u8* data;
+    u32 capacity;
+    u32 mask;
+    u32 elem_size;
+
+    // Consumer side
+    _Alignas(SF_CACHE_LINE_SIZE) sf_atomic_i64 head;
+    i64 cached_tail;     // Consumer's last view of tail
+
+    // Producer side
+    _Alignas(SF_CACHE_LINE_SIZE) sf_atomic_i64 tail;
+    i64 cached_head;     // Producer's last view of head
+} sf_spsc_ring;
+
+/**
+ * @brief Bytes of backing memory needed for a ring of 'capacity' elements.
+ */
+size_t sf_spsc_ring_calc_size(u32 capacity, u32 elem_size);
+
+/**
+ * @brief Initializes a ring over backing_buffer (at least sf_spsc_ring_calc_size bytes).
+ * @return false if capacity is not a power of two.
+ */
+bool sf_spsc_ring_init(sf_spsc_ring* ring, void* backing_buffer, u32 capacity, u32 elem_size);
+
+/**
+ * @brief Producer only. Returns false if the ring is full.
+ */
+bool sf_spsc_ring_push(sf_spsc_ring* ring, const void* elem);
+
+/**
+ * @brief Consumer only. Returns false if the ring is empty.
+ */
+bool sf_spsc_ring_pop(sf_spsc_ring* ring, void* out_elem);
+
+/**
+ * @brief Approximate number of queued elements (exact when both sides are idle).
+ */
+u32 sf_spsc_ring_count(sf_spsc_ring* ring);
+
+// --- MPMC (Multi Producer / Multi Consumer) ---
+// Bounded queue with a sequence number per cell (Vyukov).
+
+typedef struct sf_mpmc_ring {
+    u8* cells;
+    u32 capacity;
+    u32 mask;
+    u32 elem_size;
+    u32 cell_stride;
+
+    _Alignas(SF_CACHE_LINE_SIZE) sf_atomic_i64 enqueue_pos;
+    _Alignas(SF_CACHE_LINE_SIZE) sf_atomic_i64 dequeue_pos;
+} sf_mpmc_ring;
+
+size_t sf_mpmc_ring_calc_size(u32 capacity, u32 elem_size);
+bool sf_mpmc_ring_init(sf_mpmc_ring* ring, void* backing_buffer, u32 capacity, u32 elem_size);
+
+/**
+ * @brief Thread-safe. Returns false if the ring is full.
+ */
+bool sf_mpmc_ring_push(sf_mpmc_ring* ring, const void* elem);
+
+/**
+ * @brief Thread-safe. Returns false if the ring is empty.
+ */
+bool sf_mpmc_ring_pop(sf_mpmc_ring* ring, void* out_elem);
+
+#endif // SF_RING_H
@@ -0,0 +1,72 @@
+#ifndef SF_SIMD_MATH_H
+#define SF_SIMD_MATH_H
+
+#include <sionflow/base/sf_types.h>
+
+/**
+ * SionFlow Vectorized Transcendentals
+ * Stream versions of the libm functions behind SIN, COS, ATAN2, POW, SQRT and friends.
+ * Polynomial kernels run on whole SIMD registers (SSE2/NEON, AVX2, AVX-512; picked once
+ * per machine) instead of one libm call per element.
+ *
+ * Results use only IEEE basic operations, so they are identical on every target and
+ * thread count. The one exception is SIN/COS for |x| > 1e6, which defers to libm.
+ * 'out' may alias an input.
+ *
+ * Error bounds against the exact result, in units in the last place (ULP), measured
+ * against f64 libm over random f32 bit patterns and typical ranges:
+ *
+ *   function   precise     fast
+ *   sin, cos   2 ULP       5e-6 absolute
+ *   exp        1 ULP       8 ULP
+ *   log        1 ULP       12 ULP
+ *   pow        1 ULP       8 + 2 * |y * log2(x)| ULP (may round to inf just below FLT_MAX)
+ *   atan2      1 ULP       40 ULP
+ *   sqrt       0.5 ULP     0.5 ULP
+ *   rsqrt      1.5 ULP     80 ULP for normal inputs (others as precise)
+ *
+ * Special values (NaN, +-0, +-inf, negative log/sqrt arguments, the C99 pow and atan2
+ * cases) follow C99 Annex F in both modes.
+ */
+
+typedef enum {
+    SF_MATH_PRECISION_PRECISE = 0, // Bounds above; default of cartridges and contexts
+    SF_MATH_PRECISION_FAST    = 1, // Shorter polynomials and reductions, for throughput
+    SF_MATH_PRECISION_COUNT
+} sf_math_precision;
+
+static inline const char* sf_math_precision_to_str(sf_math_precision precision) {
+    switch (precision) {
+        case SF_MATH_PRECISION_PRECISE: return "precise";
+        case SF_MATH_PRECISION_FAST:    return "fast";
+        default:                        return "unknown";
+    }
+}
+
+// --- Unary ---
+
+void sf_simd_sin(const f32* x, f32* out, size_t count, sf_math_precision precision);
+void sf_simd_cos(const f32* x, f32* out, size_t count, sf_math_precision precision);
+void sf_simd_exp(const f32* x, f32* out, size_t count, sf_math_precision precision);
+void sf_simd_log(const f32* x, f32* out, size_t count, sf_math_precision precision);
+void sf_simd_sqrt(const f32* x, f32* out, size_t count, sf_math_precision precision);
+void sf_simd_rsqrt(const f32* x, f32* out, size_t count, sf_math_precision precision);
+
+// --- Binary ---
+
+/**
+ * @brief out[i] = atan2(y[i], x[i]).
+ */
+void sf_simd_atan2(const f32* y, const f32* x, f32* out, size_t count, sf_math_precision precision);
+
+/**
+ * @brief out[i] = pow(x[i], y[i]).
+ */
+void sf_simd_pow(const f32* x, const f32* y, f32* out, size_t count, sf_math_precision precision);
+
+/**
+ * @brief Name of the kernel set in use ("avx512", "avx2" or "baseline").
+ */
+const char* sf_simd_math_target(void);
+
+#endif // SF_SIMD_MATH_H
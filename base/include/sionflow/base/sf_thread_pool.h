@@ -27,11 +27,77 @@ typedef void (*sf_thread_cleanup_func)(void* thread_local_data, void* user_data)
  */
 typedef void (*sf_thread_job_func)(u32 job_idx, void* thread_local_data, void* user_data);
 
+/**
+ * @brief Scheduling lane of a batch.
+ * Workers always drain higher priority lanes first. Within a lane, workers are
+ * shared evenly between the clients that currently have batches in flight.
+ */
+typedef enum {
+    SF_THREAD_PRIORITY_CRITICAL = 0, ///< Frame-critical work (e.g. kernel dispatch).
+    SF_THREAD_PRIORITY_NORMAL,       ///< Default lane used by sf_thread_pool_run.
+    SF_THREAD_PRIORITY_BACKGROUND,   ///< Asset decoding, streaming, prefetching.
+    SF_THREAD_PRIORITY_COUNT
+} sf_thread_priority;
+
+/**
+ * @brief Timing of a single batch. Filled when the batch finishes.
+ */
+typedef struct sf_thread_pool_batch_stats {
+    u64 wall_ns;          ///< Submission to completion.
+    u64 queue_ns;         ///< Submission to the start of the first job.
+    u64 tail_ns;          ///< Last job handed out to completion (straggler latency).
+    u64 busy_ns;          ///< Sum of job time over all workers.
+    u64 busy_ns_max;      ///< Job time of the busiest worker.
+    u32 workers_joined;   ///< Workers that executed at least one job.
+    f32 imbalance_ratio;  ///< busy_ns_max / mean busy time of joined workers (1.0 = balanced).
+} sf_thread_pool_batch_stats;
+
+/**
+ * @brief Description of a batch submitted with sf_thread_pool_submit.
+ */
+typedef struct sf_thread_pool_batch_desc {
+    u32 job_count;                ///< Total number of jobs.
+    sf_thread_job_func job_fn;    ///< The function to execute.
+    void* user_data;              ///< Passed to job_fn.
+    sf_thread_priority priority;  ///< Scheduling lane.
+    u32 client_id;                ///< Submitter identity for fair sharing. 0 = anonymous (each batch is its own client).
+    sf_thread_pool_batch_stats* stats; ///< Optional. Receives the timing of this batch.
+} sf_thread_pool_batch_desc;
+
+/**
+ * @brief Scheduling counters of a single worker since the last reset.
+ */
+typedef struct sf_thread_worker_stats {
+    u64 busy_ns;          ///< Time spent inside job functions.
+    u64 idle_ns;          ///< Time parked waiting for work.
+    u64 jobs_executed;
+    u64 wakeups;          ///< Times the worker was woken up while parked.
+    u64 batches_joined;   ///< Times the worker attached to a batch.
+} sf_thread_worker_stats;
+
+/**
+ * @brief Pool-wide summary since the last reset.
+ */
+typedef struct sf_thread_pool_stats {
+    int worker_count;
+    u64 batches_completed;
+    u64 jobs_executed;
+    u64 wakeups;
+    u64 busy_ns_total;
+    u64 busy_ns_max;      ///< Busy time of the busiest worker.
+    u64 idle_ns_total;
+    f32 imbalance_ratio;  ///< busy_ns_max / mean worker busy time (1.0 = balanced).
+    u64 queue_ns_max;     ///< Longest submission -> first job latency.
+    u64 tail_ns_total;
+    u64 tail_ns_max;      ///< Longest straggler latency of a batch.
+} sf_thread_pool_stats;
+
 typedef struct sf_thread_pool_desc {
     int num_threads;             ///< Number of workers. 0 for auto (CPU count).
     sf_thread_init_func init_fn;    ///< Optional.
     sf_thread_cleanup_func cleanup_fn; ///< Optional.
     void* user_data;             ///< Passed to init/cleanup.
+    bool enable_stats;           ///< Collect per-worker scheduling metrics (adds two clock reads per job).
 } sf_thread_pool_desc;
 
 /**
@@ -46,6 +112,7 @@ void sf_thread_pool_destroy(sf_thread_pool* pool);
 
 /**
  * @brief Runs a batch of jobs in parallel and blocks until all are finished.
+ * Equivalent to sf_thread_pool_submit with SF_THREAD_PRIORITY_NORMAL and an anonymous client.
  * @param pool The pool instance.
  * @param job_count Total number of jobs.
  * @param job_fn The function to execute.
@@ -58,9 +125,53 @@ void sf_thread_pool_run(
     void* user_data
 );
 
+/**
+ * @brief Submits a batch and blocks until all of its jobs are finished.
+ * Safe to call concurrently from several threads (engines, loaders) sharing one pool.
+ * Must not be called from inside a job of the same pool.
+ */
+void sf_thread_pool_submit(sf_thread_pool* pool, const sf_thread_pool_batch_desc* desc);
+
 /**
  * @brief Returns the number of workers in the pool.
  */
 int sf_thread_pool_get_thread_count(sf_thread_pool* pool);
 
+#define SF_THREAD_POOL_SCRATCH_DEPTH 4 // Nested scratch acquisitions per worker
+
+/**
+ * @brief Takes a scratch buffer of the calling worker, for use inside a job.
+ * Scratch is a stack: each nesting level owns a buffer that grows to the largest size
+ * requested at that level and is freed when the worker exits. Acquiring never moves a
+ * buffer that is still held, so a job may keep its own scratch while calling code that
+ * acquires more (e.g. sf_gemm). Contents do not survive a release.
+ * @return NULL outside pool workers, past SF_THREAD_POOL_SCRATCH_DEPTH levels or if the
+ * buffer cannot grow.
+ */
+void* sf_thread_pool_scratch_acquire(size_t size);
+
+/**
+ * @brief Returns the most recently acquired scratch buffer of the calling worker.
+ * Releases must come in reverse order of acquisition.
+ */
+void sf_thread_pool_scratch_release(void* data);
+
+// --- Statistics (requires enable_stats) ---
+
+/**
+ * @brief Returns the pool-wide summary accumulated since the last reset.
+ */
+void sf_thread_pool_get_stats(sf_thread_pool* pool, sf_thread_pool_stats* out_stats);
+
+/**
+ * @brief Copies per-worker counters into out_stats.
+ * @return Number of workers written (at most max_workers).
+ */
+int sf_thread_pool_get_worker_stats(sf_thread_pool* pool, sf_thread_worker_stats* out_stats, int max_workers);
+
+/**
+ * @brief Clears all counters. Call at frame boundaries for per-frame metrics.
+ */
+void sf_thread_pool_reset_stats(sf_thread_pool* pool);
+
 #endif // SF_THREAD_POOL_H
@@ -43,7 +43,6 @@ typedef struct { f32 m[16]; } sf_mat4;
 typedef struct { f32 m[9]; } sf_mat3;
 
 #define SF_MAX_DIMS 8
-#define SF_MAX_REGISTERS 512
 
 // --- Source Tracking ---
 typedef struct {
@@ -8,6 +8,13 @@
 
 u32 sf_fnv1a_hash(const char* str);
 
+// 64-bit FNV-1a over arbitrary bytes (content addressing)
+u64 sf_fnv1a_hash64(const void* data, size_t size);
+
+// Continues a 64-bit FNV-1a hash (start from SF_FNV1A64_INIT) for data in several pieces
+#define SF_FNV1A64_INIT 14695981039346656037ull
+u64 sf_fnv1a_hash64_update(u64 hash, const void* data, size_t size);
+
 // --- String / Path Utils ---
 
 // Duplicates string into arena
@@ -0,0 +1,220 @@
+#include <sionflow/base/sf_crc32c.h>
+#include <sionflow/base/sf_atomic.h>
+#include <sionflow/base/sf_platform.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define SF_CRC32C_X86 1
+    #include <nmmintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define SF_CRC32C_TARGET
+    #else
+        #define SF_CRC32C_TARGET __attribute__((target("sse4.2")))
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define SF_CRC32C_ARM 1
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <arm64intr.h>
+        #define SF_CRC32C_TARGET
+    #else
+        #include <arm_acle.h>
+        #if defined(__clang__)
+            #define SF_CRC32C_TARGET __attribute__((target("crc")))
+        #else
+            #define SF_CRC32C_TARGET __attribute__((target("+crc")))
+        #endif
+    #endif
+#endif
+
+#define CRC32C_POLY 0x82F63B78u // Reflected Castagnoli polynomial
+#define CRC32C_LANE 4096        // Bytes per stream when interleaving hardware CRCs
+
+// --- Tables ---
+
+static u32 g_slice[8][256];    // Slicing-by-8
+static u32 g_shift[4][256];    // Multiply by x^(8 * CRC32C_LANE): advances a CRC over one lane
+static sf_atomic_i32 g_tables_state; // 0 = empty, 1 = building, 2 = ready
+
+static u32 sw_update(u32 s, const u8* p, size_t n);
+
+static void build_tables(void) {
+    for (u32 i = 0; i < 256; ++i) {
+        u32 c = i;
+        for (int k = 0; k < 8; ++k) c = (c >> 1) ^ (CRC32C_POLY & (0u - (c & 1)));
+        g_slice[0][i] = c;
+    }
+    for (u32 i = 0; i < 256; ++i) {
+        for (int t = 1; t < 8; ++t) g_slice[t][i] = (g_slice[t - 1][i] >> 8) ^ g_slice[0][g_slice[t - 1][i] & 0xFF];
+    }
+
+    // The shift is linear in the register, so tabulate it per byte from its 32 basis columns
+    static const u8 zeros[CRC32C_LANE];
+    u32 columns[32];
+    for (int j = 0; j < 32; ++j) columns[j] = sw_update(1u << j, zeros, CRC32C_LANE);
+    for (int t = 0; t < 4; ++t) {
+        for (u32 b = 0; b < 256; ++b) {
+            u32 v = 0;
+            for (int i = 0; i < 8; ++i) {
+                if (b & (1u << i)) v ^= columns[t * 8 + i];
+            }
+            g_shift[t][b] = v;
+        }
+    }
+}
+
+static void ensure_tables(void) {
+    if (sf_atomic_load_i32(&g_tables_state, SF_MEMORY_ORDER_ACQUIRE) == 2) return;
+
+    int32_t expected = 0;
+    if (sf_atomic_cas_i32(&g_tables_state, &expected, 1, SF_MEMORY_ORDER_ACQUIRE, SF_MEMORY_ORDER_ACQUIRE)) {
+        build_tables();
+        sf_atomic_store_i32(&g_tables_state, 2, SF_MEMORY_ORDER_RELEASE);
+        return;
+    }
+    while (sf_atomic_load_i32(&g_tables_state, SF_MEMORY_ORDER_ACQUIRE) != 2) sf_cpu_relax();
+}
+
+static inline u32 shift_lane(u32 s) {
+    return g_shift[0][s & 0xFF] ^ g_shift[1][(s >> 8) & 0xFF] ^ g_shift[2][(s >> 16) & 0xFF] ^ g_shift[3][s >> 24];
+}
+
+// --- Software (slicing-by-8) ---
+
+// Updates the raw register (no pre/post inversion). Assumes a little-endian host.
+static u32 sw_update(u32 s, const u8* p, size_t n) {
+    while (n >= 8) {
+        u64 v;
+        memcpy(&v, p, sizeof(v));
+        v ^= s;
+        s = g_slice[7][v & 0xFF] ^ g_slice[6][(v >> 8) & 0xFF] ^
+            g_slice[5][(v >> 16) & 0xFF] ^ g_slice[4][(v >> 24) & 0xFF] ^
+            g_slice[3][(v >> 32) & 0xFF] ^ g_slice[2][(v >> 40) & 0xFF] ^
+            g_slice[1][(v >> 48) & 0xFF] ^ g_slice[0][v >> 56];
+        p += 8;
+        n -= 8;
+    }
+    while (n--) s = (s >> 8) ^ g_slice[0][(s ^ *p++) & 0xFF];
+    return s;
+}
+
+// --- Hardware ---
+
+#if defined(SF_CRC32C_X86) || defined(SF_CRC32C_ARM)
+
+#if defined(SF_CRC32C_X86)
+    #define CRC_U64(s, v) (u32)_mm_crc32_u64((s), (v))
+    #define CRC_U8(s, v)  _mm_crc32_u8((s), (v))
+#else
+    #define CRC_U64(s, v) __crc32cd((s), (v))
+    #define CRC_U8(s, v)  __crc32cb((s), (v))
+#endif
+
+SF_CRC32C_TARGET
+static u32 hw_stream(u32 s, const u8* p, size_t n) {
+    while (n >= 8) {
+        u64 v;
+        memcpy(&v, p, sizeof(v));
+        s = CRC_U64(s, v);
+        p += 8;
+        n -= 8;
+    }
+    while (n--) s = CRC_U8(s, *p++);
+    return s;
+}
+
+// The CRC instruction has a latency of ~3 cycles but issues every cycle, so three
+// independent lanes run in parallel and are merged with the precomputed lane shift.
+SF_CRC32C_TARGET
+static u32 hw_update(u32 s, const u8* p, size_t n) {
+    while (n >= 3 * CRC32C_LANE) {
+        u32 a = s, b = 0, c = 0;
+        const u8* pa = p;
+        const u8* pb = p + CRC32C_LANE;
+        const u8* pc = p + 2 * CRC32C_LANE;
+        for (size_t i = 0; i < CRC32C_LANE; i += 8) {
+            u64 va, vb, vc;
+            memcpy(&va, pa + i, 8);
+            memcpy(&vb, pb + i, 8);
+            memcpy(&vc, pc + i, 8);
+            a = CRC_U64(a, va);
+            b = CRC_U64(b, vb);
+            c = CRC_U64(c, vc);
+        }
+        s = shift_lane(shift_lane(a) ^ b) ^ c;
+        p += 3 * CRC32C_LANE;
+        n -= 3 * CRC32C_LANE;
+    }
+    return hw_stream(s, p, n);
+}
+
+#endif
+
+// --- API ---
+
+bool sf_crc32c_hw_available(void) {
+#if defined(SF_CRC32C_X86)
+    return sf_cpu_has(SF_CPU_SSE42);
+#elif defined(SF_CRC32C_ARM)
+    return sf_cpu_has(SF_CPU_ARM_CRC32);
+#else
+    return false;
+#endif
+}
+
+u32 sf_crc32c(u32 crc, const void* data, size_t size) {
+    if (!data || size == 0) return crc;
+    ensure_tables();
+
+    u32 s = ~crc;
+#if defined(SF_CRC32C_X86) || defined(SF_CRC32C_ARM)
+    if (sf_crc32c_hw_available()) return ~hw_update(s, (const u8*)data, size);
+#endif
+    return ~sw_update(s, (const u8*)data, size);
+}
+
+// --- Combine (GF(2) matrix method) ---
+
+static u32 gf2_matrix_times(const u32* mat, u32 vec) {
+    u32 sum = 0;
+    while (vec) {
+        if (vec & 1) sum ^= *mat;
+        vec >>= 1;
+        mat++;
+    }
+    return sum;
+}
+
+static void gf2_matrix_square(u32* square, const u32* mat) {
+    for (int n = 0; n < 32; ++n) square[n] = gf2_matrix_times(mat, mat[n]);
+}
+
+u32 sf_crc32c_combine(u32 crc_a, u32 crc_b, size_t size_b) {
+    if (size_b == 0) return crc_a;
+
+    u32 even[32]; // Operator for 2^k zero bits (even k)
+    u32 odd[32];  // Operator for 2^k zero bits (odd k)
+
+    odd[0] = CRC32C_POLY; // One zero bit
+    u32 row = 1;
+    for (int n = 1; n < 32; ++n) {
+        odd[n] = row;
+        row <<= 1;
+    }
+    gf2_matrix_square(even, odd); // 2 bits
+    gf2_matrix_square(odd, even); // 4 bits
+
+    // Apply len(B) zero bytes to crc_a, one power of two at a time
+    do {
+        gf2_matrix_square(even, odd);
+        if (size_b & 1) crc_a = gf2_matrix_times(even, crc_a);
+        size_b >>= 1;
+        if (size_b == 0) break;
+
+        gf2_matrix_square(odd, even);
+        if (size_b & 1) crc_a = gf2_matrix_times(odd, crc_a);
+        size_b >>= 1;
+    } while (size_b != 0);
+
+    return crc_a ^ crc_b;
+}
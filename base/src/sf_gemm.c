@@ -0,0 +1,329 @@
+#include <sionflow/base/sf_gemm.h>
+#include "sf_gemm_kernels.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Blocking. An nr-wide sliver of packed B (KC x nr) stays in L1 while it meets every row
+// panel of the packed A block (MC x KC, L2); the packed B block (KC x NC) stays in L2/L3
+// and is reused by every MC-row tile of the strip of C a job covers.
+#define GEMM_KC 256
+#define GEMM_MC_PANELS 16    // MC = 16 * mr rows
+#define GEMM_NC 512          // Multiple of every nr
+#define GEMM_SMALL_WORK 4096 // m * n * k up to which packing does not pay off
+#define GEMM_JOB_WORK 65536  // Multiply-adds per job of unpacked or batched work
+#define GEMM_JOBS_PER_THREAD 4
+
+// f32 and i32 share the packing code, which only copies 4-byte elements
+#define GEMM_ELEM sizeof(f32)
+
+// --- Kernel Selection ---
+
+static sf_atomic_ptr g_kernels;
+
+static const sf_gemm_kernel_table* kernels(void) {
+    static const sf_cpu_variant variants[] = {
+#ifdef SF_HAVE_TARGET_AVX512
+        { SF_CPU_VARIANT_AVX512, &sf_gemm_kernels_avx512 },
+#endif
+#ifdef SF_HAVE_TARGET_AVX2
+        { SF_CPU_VARIANT_AVX2, &sf_gemm_kernels_avx2 },
+#endif
+        { 0, &sf_gemm_kernels },
+    };
+    return (const sf_gemm_kernel_table*)sf_cpu_select_cached(&g_kernels, variants, (uint32_t)(sizeof(variants) / sizeof(variants[0])));
+}
+
+const char* sf_gemm_target(void) {
+    return kernels()->name;
+}
+
+// --- Blocked Product ---
+
+typedef enum {
+    GEMM_F32,
+    GEMM_I32
+} gemm_type;
+
+typedef struct {
+    const sf_gemm_kernel_table* kern;
+    gemm_type type;
+    size_t m, n, k;
+    const u8* a;
+    const u8* b;
+    u8* c;
+    size_t lda, ldb, ldc; // In elements
+    bool packed;          // false: unpacked rows kernel
+    size_t mc, nc;        // Tile of C
+    size_t m_tiles, n_tiles;
+    size_t m_per_job;     // Job = one column of nc and a strip of m_per_job tiles
+    size_t jobs;
+} gemm_ctx;
+
+static size_t min_size(size_t a, size_t b) { return a < b ? a : b; }
+static size_t div_up(size_t a, size_t b) { return (a + b - 1) / b; }
+
+static size_t gemm_work(size_t m, size_t n, size_t k) { return m * n * k; }
+
+static size_t min_parallel(const sf_math_batch_exec* exec) {
+    return exec && exec->min_parallel ? exec->min_parallel : SF_GEMM_DEFAULT_MIN_PARALLEL;
+}
+
+// 'threads' > 0 splits the tiles finer until every worker gets a few of them
+static void gemm_init(gemm_ctx* g, gemm_type type, size_t m, size_t n, size_t k, const void* a, size_t lda,
+                      const void* b, size_t ldb, void* c, size_t ldc, u32 threads) {
+    const sf_gemm_kernel_table* kern = kernels();
+    *g = (gemm_ctx){ .kern = kern, .type = type, .m = m, .n = n, .k = k, .a = (const u8*)a, .b = (const u8*)b,
+                     .c = (u8*)c, .lda = lda, .ldb = ldb, .ldc = ldc };
+
+    // Packing needs enough work to amortize, and C at least half a tile wide
+    g->packed = gemm_work(m, n, k) > GEMM_SMALL_WORK && n * 2 >= kern->nr;
+    if (g->packed) {
+        size_t mc_panels = GEMM_MC_PANELS, nc_panels = GEMM_NC / kern->nr;
+        while (threads && div_up(m, mc_panels * kern->mr) * div_up(n, nc_panels * kern->nr) < (size_t)threads * GEMM_JOBS_PER_THREAD) {
+            if (nc_panels > 1 && (nc_panels * kern->nr >= mc_panels * kern->mr || mc_panels == 1)) {
+                nc_panels /= 2;
+            } else if (mc_panels > 1) {
+                mc_panels /= 2;
+            } else {
+                break;
+            }
+        }
+        g->mc = min_size(mc_panels * kern->mr, m);
+        g->nc = min_size(nc_panels * kern->nr, n);
+    } else {
+        g->nc = n;
+        g->mc = min_size(m, GEMM_JOB_WORK / (n * (k ? k : 1)) + 1);
+    }
+    g->m_tiles = div_up(m, g->mc);
+    g->n_tiles = div_up(n, g->nc);
+
+    // Strips share one packed B block; keep enough of them to feed every worker
+    g->m_per_job = 1;
+    if (g->packed) {
+        size_t strips = threads ? div_up((size_t)threads * GEMM_JOBS_PER_THREAD, g->n_tiles) : 1;
+        g->m_per_job = g->m_tiles / strips > 1 ? g->m_tiles / strips : 1;
+    }
+    g->jobs = div_up(g->m_tiles, g->m_per_job) * g->n_tiles;
+}
+
+static size_t pack_a_bytes(const gemm_ctx* g) {
+    return div_up(g->mc, g->kern->mr) * g->kern->mr * min_size(g->k, GEMM_KC) * GEMM_ELEM;
+}
+
+static size_t pack_b_bytes(const gemm_ctx* g) {
+    return div_up(g->nc, g->kern->nr) * g->kern->nr * min_size(g->k, GEMM_KC) * GEMM_ELEM;
+}
+
+// Pack buffer of a product: a level of the worker's scratch stack inside pool jobs,
+// else the heap ('heap' says which, for release_pack)
+static u8* pack_buffer(const gemm_ctx* g, bool* heap) {
+    *heap = false;
+    if (!g->packed || g->k == 0) return NULL;
+    size_t bytes = pack_a_bytes(g) + pack_b_bytes(g);
+    u8* pack = (u8*)sf_thread_pool_scratch_acquire(bytes);
+    if (!pack) {
+        pack = (u8*)malloc(bytes);
+        *heap = pack != NULL;
+    }
+    return pack;
+}
+
+static void release_pack(u8* pack, bool heap) {
+    if (heap) {
+        free(pack);
+    } else {
+        sf_thread_pool_scratch_release(pack);
+    }
+}
+
+// A[i0 : i0 + mc, p0 : p0 + kc] -> panels of mr rows, column by column
+static void pack_a(const gemm_ctx* g, size_t i0, size_t mc, size_t p0, size_t kc, u8* dst) {
+    const u32 mr = g->kern->mr;
+    for (size_t ir = 0; ir < mc; ir += mr) {
+        size_t rows = min_size(mr, mc - ir);
+        const u8* src = g->a + ((i0 + ir) * g->lda + p0) * GEMM_ELEM;
+        for (size_t p = 0; p < kc; ++p) {
+            for (size_t r = 0; r < rows; ++r) memcpy(dst + r * GEMM_ELEM, src + (r * g->lda + p) * GEMM_ELEM, GEMM_ELEM);
+            memset(dst + rows * GEMM_ELEM, 0, (mr - rows) * GEMM_ELEM);
+            dst += mr * GEMM_ELEM;
+        }
+    }
+}
+
+// B[p0 : p0 + kc, j0 : j0 + nc] -> panels of nr columns, row by row
+static void pack_b(const gemm_ctx* g, size_t p0, size_t kc, size_t j0, size_t nc, u8* dst) {
+    const u32 nr = g->kern->nr;
+    for (size_t jr = 0; jr < nc; jr += nr) {
+        size_t cols = min_size(nr, nc - jr);
+        const u8* src = g->b + (p0 * g->ldb + j0 + jr) * GEMM_ELEM;
+        for (size_t p = 0; p < kc; ++p) {
+            memcpy(dst, src + p * g->ldb * GEMM_ELEM, cols * GEMM_ELEM);
+            memset(dst + cols * GEMM_ELEM, 0, (nr - cols) * GEMM_ELEM);
+            dst += nr * GEMM_ELEM;
+        }
+    }
+}
+
+static void run_rows(const gemm_ctx* g, size_t i0, size_t mc, size_t j0, size_t nc) {
+    const u8* a = g->a + i0 * g->lda * GEMM_ELEM;
+    const u8* b = g->b + j0 * GEMM_ELEM;
+    u8* c = g->c + (i0 * g->ldc + j0) * GEMM_ELEM;
+    if (g->type == GEMM_F32) {
+        g->kern->rows_f32(mc, nc, g->k, (const f32*)a, g->lda, (const f32*)b, g->ldb, (f32*)c, g->ldc);
+    } else {
+        g->kern->rows_i32(mc, nc, g->k, (const u32*)a, g->lda, (const u32*)b, g->ldb, (u32*)c, g->ldc);
+    }
+}
+
+// Without a buffer the rows kernel takes over; it computes the same bits
+static void run_job(const gemm_ctx* g, size_t job, u8* pack) {
+    const size_t j0 = job % g->n_tiles * g->nc, nc = min_size(g->nc, g->n - j0);
+    const size_t i_begin = job / g->n_tiles * g->m_per_job * g->mc;
+    const size_t i_end = min_size(i_begin + g->m_per_job * g->mc, g->m);
+    if (g->k == 0) {
+        for (size_t i = i_begin; i < i_end; ++i) memset(g->c + (i * g->ldc + j0) * GEMM_ELEM, 0, nc * GEMM_ELEM);
+        return;
+    }
+    if (!pack) {
+        run_rows(g, i_begin, i_end - i_begin, j0, nc);
+        return;
+    }
+
+    const u32 mr = g->kern->mr, nr = g->kern->nr;
+    u8* pa = pack;
+    u8* pb = pack + pack_a_bytes(g);
+    for (size_t p0 = 0; p0 < g->k; p0 += GEMM_KC) {
+        const size_t kc = min_size(GEMM_KC, g->k - p0);
+        pack_b(g, p0, kc, j0, nc, pb);
+
+        for (size_t i0 = i_begin; i0 < i_end; i0 += g->mc) {
+            const size_t mc = min_size(g->mc, i_end - i0);
+            pack_a(g, i0, mc, p0, kc, pa);
+
+            for (size_t jr = 0; jr < nc; jr += nr) {
+                const u8* b = pb + jr * kc * GEMM_ELEM;
+                for (size_t ir = 0; ir < mc; ir += mr) {
+                    const u8* a = pa + ir * kc * GEMM_ELEM;
+                    u8* c = g->c + ((i0 + ir) * g->ldc + j0 + jr) * GEMM_ELEM;
+                    u32 m = (u32)min_size(mr, mc - ir), n = (u32)min_size(nr, nc - jr);
+                    if (g->type == GEMM_F32) {
+                        g->kern->tile_f32(kc, (const f32*)a, (const f32*)b, (f32*)c, g->ldc, m, n, p0 > 0);
+                    } else {
+                        g->kern->tile_i32(kc, (const u32*)a, (const u32*)b, (u32*)c, g->ldc, m, n, p0 > 0);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void run_jobs(const gemm_ctx* g, size_t first, size_t count) {
+    bool heap;
+    u8* pack = pack_buffer(g, &heap);
+    for (size_t job = first; job < first + count; ++job) run_job(g, job, pack);
+    release_pack(pack, heap);
+}
+
+static void gemm_job_entry(u32 job_idx, void* thread_local_data, void* user_data) {
+    (void)thread_local_data;
+    run_jobs((const gemm_ctx*)user_data, job_idx, 1);
+}
+
+static void gemm(const sf_math_batch_exec* exec, gemm_type type, size_t m, size_t n, size_t k, const void* a, size_t lda,
+                 const void* b, size_t ldb, void* c, size_t ldc) {
+    if (m == 0 || n == 0 || !c || (k && (!a || !b))) return;
+
+    sf_thread_pool* pool = exec && gemm_work(m, n, k) >= min_parallel(exec) ? exec->pool : NULL;
+    u32 threads = pool ? (u32)sf_thread_pool_get_thread_count(pool) : 0;
+
+    gemm_ctx g;
+    gemm_init(&g, type, m, n, k, a, lda, b, ldb, c, ldc, threads);
+    if (pool && g.jobs > 1 && g.jobs <= UINT32_MAX) {
+        sf_thread_pool_run(pool, (u32)g.jobs, gemm_job_entry, &g);
+    } else {
+        run_jobs(&g, 0, g.jobs);
+    }
+}
+
+void sf_gemm_f32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const f32* a, size_t lda, const f32* b, size_t ldb, f32* c, size_t ldc) {
+    gemm(exec, GEMM_F32, m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void sf_gemm_i32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const i32* a, size_t lda, const i32* b, size_t ldb, i32* c, size_t ldc) {
+    gemm(exec, GEMM_I32, m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+// --- Batched Products ---
+
+typedef struct {
+    gemm_type type;
+    size_t m, n, k;
+    size_t count;
+    size_t per_job; // Products per pool job
+    const u8* a;
+    const u8* b;
+    u8* c;
+} gemm_batch_ctx;
+
+static void run_products(const gemm_batch_ctx* ctx, size_t first, size_t count) {
+    const size_t m = ctx->m, n = ctx->n, k = ctx->k;
+    const u8* a = ctx->a + first * m * k * GEMM_ELEM;
+    const u8* b = ctx->b + first * k * n * GEMM_ELEM;
+    u8* c = ctx->c + first * m * n * GEMM_ELEM;
+
+    if (ctx->type == GEMM_F32 && m == n && n == k && (m == 3 || m == 4)) {
+        const sf_gemm_kernel_table* kern = kernels();
+        if (m == 3) {
+            kern->mat3_f32((const f32*)a, (const f32*)b, (f32*)c, count);
+        } else {
+            kern->mat4_f32((const f32*)a, (const f32*)b, (f32*)c, count);
+        }
+        return;
+    }
+    // Every product has the same shape, so they share one pack buffer
+    u8* pack = NULL;
+    bool heap = false;
+    for (size_t i = 0; i < count; ++i) {
+        gemm_ctx g;
+        gemm_init(&g, ctx->type, m, n, k, a + i * m * k * GEMM_ELEM, k, b + i * k * n * GEMM_ELEM, n,
+                  c + i * m * n * GEMM_ELEM, n, 0);
+        if (i == 0) pack = pack_buffer(&g, &heap);
+        for (size_t job = 0; job < g.jobs; ++job) run_job(&g, job, pack);
+    }
+    release_pack(pack, heap);
+}
+
+static void batch_job_entry(u32 job_idx, void* thread_local_data, void* user_data) {
+    (void)thread_local_data;
+    const gemm_batch_ctx* ctx = (const gemm_batch_ctx*)user_data;
+    size_t first = (size_t)job_idx * ctx->per_job;
+    run_products(ctx, first, min_size(ctx->per_job, ctx->count - first));
+}
+
+static void gemm_batched(const sf_math_batch_exec* exec, gemm_type type, size_t m, size_t n, size_t k, const void* a,
+                         const void* b, void* c, size_t count) {
+    if (count == 0 || m == 0 || n == 0 || !c || (k && (!a || !b))) return;
+    // A single product is better split over tiles of C
+    if (count == 1) {
+        gemm(exec, type, m, n, k, a, k, b, n, c, n);
+        return;
+    }
+
+    const size_t work = gemm_work(m, n, k ? k : 1);
+    gemm_batch_ctx ctx = { .type = type, .m = m, .n = n, .k = k, .count = count, .per_job = GEMM_JOB_WORK / work + 1,
+                           .a = (const u8*)a, .b = (const u8*)b, .c = (u8*)c };
+    size_t jobs = div_up(count, ctx.per_job);
+    if (exec && exec->pool && work * count >= min_parallel(exec) && jobs > 1 && jobs <= UINT32_MAX) {
+        sf_thread_pool_run(exec->pool, (u32)jobs, batch_job_entry, &ctx);
+    } else {
+        run_products(&ctx, 0, count);
+    }
+}
+
+void sf_gemm_batched_f32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const f32* a, const f32* b, f32* c, size_t count) {
+    gemm_batched(exec, GEMM_F32, m, n, k, a, b, c, count);
+}
+
+void sf_gemm_batched_i32(const sf_math_batch_exec* exec, size_t m, size_t n, size_t k, const i32* a, const i32* b, i32* c, size_t count) {
+    gemm_batched(exec, GEMM_I32, m, n, k, a, b, c, count);
+}
@@ -0,0 +1,182 @@
+#include "sf_gemm_kernels.h"
+#include "sf_simd_vec.h"
+
+// Every kernel forms c[i][j] = ((a[i][0] * b[0][j] + a[i][1] * b[1][j]) + ...) in
+// ascending k, starting from the first product, so tiles, blocks and targets agree bit
+// for bit.
+
+// --- Register Tiles ---
+
+#ifdef SF_SIMD_VECTOR
+// Six rows of two vectors: twelve accumulators, two B vectors and a broadcast fit the
+// 16 registers of SSE2/AVX2 (AVX-512 and NEON have 32).
+#define GEMM_MR 6
+#define GEMM_NR (2 * SF_SIMD_LANES)
+
+#define SF__GEMM_ROWS(X, ...) X(0, __VA_ARGS__) X(1, __VA_ARGS__) X(2, __VA_ARGS__) \
+                              X(3, __VA_ARGS__) X(4, __VA_ARGS__) X(5, __VA_ARGS__)
+#define SF__GEMM_LOAD_ROW(r, src, ld) \
+    memcpy(&acc[r][0], (src) + (r) * (ld), sizeof(acc[r][0])); \
+    memcpy(&acc[r][1], (src) + (r) * (ld) + SF_SIMD_LANES, sizeof(acc[r][1]));
+#define SF__GEMM_STORE_ROW(r, dst, ld) \
+    memcpy((dst) + (r) * (ld), &acc[r][0], sizeof(acc[r][0])); \
+    memcpy((dst) + (r) * (ld) + SF_SIMD_LANES, &acc[r][1], sizeof(acc[r][1]));
+#define SF__GEMM_MUL_ROW(r, ap, b0, b1) acc[r][0] = (ap)[r] * (b0); acc[r][1] = (ap)[r] * (b1);
+#define SF__GEMM_ADD_ROW(r, ap, b0, b1) acc[r][0] += (ap)[r] * (b0); acc[r][1] += (ap)[r] * (b1);
+
+// Edge tiles run through a zeroed MR x NR buffer so the inner loop is always full width
+#define SF__GEMM_TILE(name, T, VT) \
+    static void name(size_t kc, const T* a, const T* b, T* c, size_t ldc, u32 m, u32 n, bool accumulate) { \
+        T edge[GEMM_MR * GEMM_NR]; \
+        T* dst = c; \
+        size_t ld = ldc; \
+        if (m < GEMM_MR || n < GEMM_NR) { \
+            memset(edge, 0, sizeof(edge)); \
+            if (accumulate) { \
+                for (u32 r = 0; r < m; ++r) memcpy(edge + r * GEMM_NR, c + r * ldc, n * sizeof(T)); \
+            } \
+            dst = edge; \
+            ld = GEMM_NR; \
+        } \
+        VT acc[GEMM_MR][2]; \
+        VT b0, b1; \
+        size_t p = 0; \
+        if (accumulate) { \
+            SF__GEMM_ROWS(SF__GEMM_LOAD_ROW, dst, ld) \
+        } else { \
+            memcpy(&b0, b, sizeof(b0)); \
+            memcpy(&b1, b + SF_SIMD_LANES, sizeof(b1)); \
+            SF__GEMM_ROWS(SF__GEMM_MUL_ROW, a, b0, b1) \
+            p = 1; \
+        } \
+        for (; p < kc; ++p) { \
+            const T* ap = a + p * GEMM_MR; \
+            memcpy(&b0, b + p * GEMM_NR, sizeof(b0)); \
+            memcpy(&b1, b + p * GEMM_NR + SF_SIMD_LANES, sizeof(b1)); \
+            SF__GEMM_ROWS(SF__GEMM_ADD_ROW, ap, b0, b1) \
+        } \
+        SF__GEMM_ROWS(SF__GEMM_STORE_ROW, dst, ld) \
+        if (dst == edge) { \
+            for (u32 r = 0; r < m; ++r) memcpy(c + r * ldc, edge + r * GEMM_NR, n * sizeof(T)); \
+        } \
+    }
+#else
+#define GEMM_MR 4
+#define GEMM_NR 4
+
+#define SF__GEMM_TILE(name, T, VT) \
+    static void name(size_t kc, const T* a, const T* b, T* c, size_t ldc, u32 m, u32 n, bool accumulate) { \
+        for (u32 r = 0; r < m; ++r) { \
+            for (u32 j = 0; j < n; ++j) { \
+                T s = accumulate ? c[r * ldc + j] + a[r] * b[j] : a[r] * b[j]; \
+                for (size_t p = 1; p < kc; ++p) s += a[p * GEMM_MR + r] * b[p * GEMM_NR + j]; \
+                c[r * ldc + j] = s; \
+            } \
+        } \
+    }
+#endif
+
+SF__GEMM_TILE(k_tile_f32, f32, vf32)
+SF__GEMM_TILE(k_tile_i32, u32, vu32)
+
+// --- Unpacked Rows ---
+// Row i of C accumulates a[i][p] * (row p of B); the row stays in L1 for the narrow or
+// small products this path serves.
+
+#ifdef SF_SIMD_VECTOR
+#define SF__GEMM_ROWS_KERNEL(name, T, VT) \
+    static void name(size_t m, size_t n, size_t k, const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc) { \
+        for (size_t i = 0; i < m; ++i) { \
+            const T* ai = a + i * lda; \
+            T* ci = c + i * ldc; \
+            for (size_t p = 0; p < k; ++p) { \
+                const T* bp = b + p * ldb; \
+                const T s = ai[p]; \
+                size_t j = 0; \
+                for (; j + SF_SIMD_LANES <= n; j += SF_SIMD_LANES) { \
+                    VT bv, cv; \
+                    memcpy(&bv, bp + j, sizeof(bv)); \
+                    if (p == 0) { \
+                        cv = s * bv; \
+                    } else { \
+                        memcpy(&cv, ci + j, sizeof(cv)); \
+                        cv += s * bv; \
+                    } \
+                    memcpy(ci + j, &cv, sizeof(cv)); \
+                } \
+                for (; j < n; ++j) ci[j] = p == 0 ? s * bp[j] : ci[j] + s * bp[j]; \
+            } \
+        } \
+    }
+#else
+#define SF__GEMM_ROWS_KERNEL(name, T, VT) \
+    static void name(size_t m, size_t n, size_t k, const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc) { \
+        for (size_t i = 0; i < m; ++i) { \
+            for (size_t p = 0; p < k; ++p) { \
+                const T s = a[i * lda + p]; \
+                for (size_t j = 0; j < n; ++j) { \
+                    c[i * ldc + j] = p == 0 ? s * b[p * ldb + j] : c[i * ldc + j] + s * b[p * ldb + j]; \
+                } \
+            } \
+        } \
+    }
+#endif
+
+SF__GEMM_ROWS_KERNEL(k_rows_f32, f32, vf32)
+SF__GEMM_ROWS_KERNEL(k_rows_i32, u32, vu32)
+
+// --- Small Matrices ---
+// One 4-float vector per row of B; row i of C is a[i][0] * B0 + a[i][1] * B1 + ...
+
+static void k_mat3_f32(const f32* a, const f32* b, f32* c, size_t count) {
+    for (size_t i = 0; i < count; ++i, a += 9, b += 9, c += 9) {
+#ifdef SF_SIMD_VECTOR
+        vf32x4 b0 = { 0 }, b1 = { 0 }, b2 = { 0 };
+        memcpy(&b0, b, 3 * sizeof(f32));
+        memcpy(&b1, b + 3, 3 * sizeof(f32));
+        memcpy(&b2, b + 6, 3 * sizeof(f32));
+        for (int r = 0; r < 3; ++r) {
+            vf32x4 row = a[r * 3] * b0 + a[r * 3 + 1] * b1 + a[r * 3 + 2] * b2;
+            memcpy(c + r * 3, &row, 3 * sizeof(f32));
+        }
+#else
+        for (int r = 0; r < 3; ++r) {
+            for (int j = 0; j < 3; ++j) c[r * 3 + j] = a[r * 3] * b[j] + a[r * 3 + 1] * b[3 + j] + a[r * 3 + 2] * b[6 + j];
+        }
+#endif
+    }
+}
+
+static void k_mat4_f32(const f32* a, const f32* b, f32* c, size_t count) {
+    for (size_t i = 0; i < count; ++i, a += 16, b += 16, c += 16) {
+#ifdef SF_SIMD_VECTOR
+        vf32x4 b0, b1, b2, b3;
+        memcpy(&b0, b, sizeof(b0));
+        memcpy(&b1, b + 4, sizeof(b1));
+        memcpy(&b2, b + 8, sizeof(b2));
+        memcpy(&b3, b + 12, sizeof(b3));
+        for (int r = 0; r < 4; ++r) {
+            vf32x4 row = a[r * 4] * b0 + a[r * 4 + 1] * b1 + a[r * 4 + 2] * b2 + a[r * 4 + 3] * b3;
+            memcpy(c + r * 4, &row, sizeof(row));
+        }
+#else
+        for (int r = 0; r < 4; ++r) {
+            for (int j = 0; j < 4; ++j) {
+                c[r * 4 + j] = a[r * 4] * b[j] + a[r * 4 + 1] * b[4 + j] + a[r * 4 + 2] * b[8 + j] + a[r * 4 + 3] * b[12 + j];
+            }
+        }
+#endif
+    }
+}
+
+const sf_gemm_kernel_table SF_TARGET_SYMBOL(sf_gemm_kernels) = {
+    .name = SF_SIMD_TARGET_NAME,
+    .mr = GEMM_MR,
+    .nr = GEMM_NR,
+    .tile_f32 = k_tile_f32,
+    .tile_i32 = k_tile_i32,
+    .rows_f32 = k_rows_f32,
+    .rows_i32 = k_rows_i32,
+    .mat3_f32 = k_mat3_f32,
+    .mat4_f32 = k_mat4_f32,
+};
@@ -0,0 +1,35 @@
+#ifndef SF_GEMM_KERNELS_H
+#define SF_GEMM_KERNELS_H
+
+#include <sionflow/base/sf_types.h>
+#include <sionflow/base/sf_platform.h>
+
+// Kernels of sf_gemm, one table per target ISA (see sf_simd_vec.h). i32 data is passed
+// as u32 so products wrap around.
+//
+// tile_*: C[m, n] = A * B (or C += A * B) for one mr x nr register tile, m <= mr, n <= nr.
+//         'a' holds kc groups of mr values (column p of an mr-row panel of A), 'b' kc
+//         groups of nr values (row p of an nr-column panel of B); both zero padded.
+// rows_*: C[m, n] = A[m, k] * B[k, n] straight from the unpacked operands, k > 0.
+// mat*_f32: 'count' contiguous row-major 3x3 / 4x4 products.
+typedef struct {
+    const char* name;
+    u32 mr;
+    u32 nr;
+    void (*tile_f32)(size_t kc, const f32* a, const f32* b, f32* c, size_t ldc, u32 m, u32 n, bool accumulate);
+    void (*tile_i32)(size_t kc, const u32* a, const u32* b, u32* c, size_t ldc, u32 m, u32 n, bool accumulate);
+    void (*rows_f32)(size_t m, size_t n, size_t k, const f32* a, size_t lda, const f32* b, size_t ldb, f32* c, size_t ldc);
+    void (*rows_i32)(size_t m, size_t n, size_t k, const u32* a, size_t lda, const u32* b, size_t ldb, u32* c, size_t ldc);
+    void (*mat3_f32)(const f32* a, const f32* b, f32* c, size_t count);
+    void (*mat4_f32)(const f32* a, const f32* b, f32* c, size_t count);
+} sf_gemm_kernel_table;
+
+extern const sf_gemm_kernel_table sf_gemm_kernels;
+#ifdef SF_HAVE_TARGET_AVX2
+extern const sf_gemm_kernel_table sf_gemm_kernels_avx2;
+#endif
+#ifdef SF_HAVE_TARGET_AVX512
+extern const sf_gemm_kernel_table sf_gemm_kernels_avx512;
+#endif
+
+#endif // SF_GEMM_KERNELS_H
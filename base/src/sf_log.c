@@ -24,6 +24,23 @@ static struct {
 // Default global level (initially INFO until configured)
 sf_log_level g_sf_log_global_level = SF_LOG_LEVEL_INFO;
 
+// Wall clock as HH:MM:SS.mmm
+static void format_time(char* buf, size_t size) {
+    struct timespec ts;
+    if (timespec_get(&ts, TIME_UTC) == 0) {
+        ts.tv_sec = time(NULL);
+        ts.tv_nsec = 0;
+    }
+    struct tm* t = localtime(&ts.tv_sec);
+    if (!t) {
+        snprintf(buf, size, "00:00:00.000");
+        return;
+    }
+    char hms[12];
+    strftime(hms, sizeof(hms), "%H:%M:%S", t);
+    snprintf(buf, size, "%s.%03d", hms, (int)(ts.tv_nsec / 1000000));
+}
+
 // --- Default Console Sink ---
 
 static const char* level_colors[] = {
@@ -42,15 +59,8 @@ static const char* level_names[] = {
 static void console_sink(void* user_data, sf_log_level level, const char* file, int line, const char* message) {
     (void)user_data;
     
-    // Get time
-    time_t now = time(NULL);
-    struct tm* t = localtime(&now);
     char time_buf[16];
-    if (t) {
-        strftime(time_buf, sizeof(time_buf), "%H:%M:%S", t);
-    } else {
-        strcpy(time_buf, "00:00:00");
-    }
+    format_time(time_buf, sizeof(time_buf));
 
     const char* color = (level <= SF_LOG_LEVEL_TRACE) ? level_colors[level] : "\x1b[0m";
     const char* reset = "\x1b[0m";
@@ -77,15 +87,8 @@ static void file_sink(void* user_data, sf_log_level level, const char* file, int
     FILE* f = (FILE*)user_data;
     if (!f) return;
 
-    // Get time
-    time_t now = time(NULL);
-    struct tm* t = localtime(&now);
     char time_buf[16];
-    if (t) {
-        strftime(time_buf, sizeof(time_buf), "%H:%M:%S", t);
-    } else {
-        strcpy(time_buf, "00:00:00");
-    }
+    format_time(time_buf, sizeof(time_buf));
 
     const char* name = (level <= SF_LOG_LEVEL_TRACE) ? level_names[level] : "UNK";
 
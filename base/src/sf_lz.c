@@ -0,0 +1,163 @@
+#include <sionflow/base/sf_lz.h>
+#include <string.h>
+
+#define LZ_MIN_MATCH    4
+#define LZ_MAX_OFFSET   65535
+#define LZ_HASH_BITS    14
+#define LZ_LAST_LITERALS 5  // Trailing bytes always emitted as literals
+#define LZ_MF_LIMIT     12  // No match may start within this many bytes of the end
+
+static inline u32 read_u32(const u8* p) {
+    u32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline u32 lz_hash(u32 v) {
+    return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+// Lengths >= 15 continue in extra bytes of 255 (LZ4 convention)
+static u8* write_length(u8* op, size_t len) {
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (u8)len;
+    return op;
+}
+
+size_t sf_lz_compress_bound(size_t src_size) {
+    return src_size + src_size / 255 + 16;
+}
+
+// --- Compression ---
+
+size_t sf_lz_compress(const void* src, size_t src_size, void* dst, size_t dst_capacity) {
+    if (dst_capacity < sf_lz_compress_bound(src_size)) return 0;
+
+    const u8* ip = (const u8*)src;
+    const u8* const base = ip;
+    const u8* const end = ip + src_size;
+    const u8* anchor = ip;
+    u8* op = (u8*)dst;
+
+    u32 table[1 << LZ_HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    if (src_size >= LZ_MF_LIMIT) {
+        const u8* const match_limit = end - LZ_LAST_LITERALS;
+        const u8* const mf_limit = end - LZ_MF_LIMIT;
+        ip++;
+
+        while (ip < mf_limit) {
+            u32 seq = read_u32(ip);
+            u32 h = lz_hash(seq);
+            const u8* ref = base + table[h];
+            table[h] = (u32)(ip - base);
+
+            if (ref >= ip || ip - ref > LZ_MAX_OFFSET || read_u32(ref) != seq) {
+                ip++;
+                continue;
+            }
+
+            // Extend backwards over pending literals
+            while (ip > anchor && ref > base && ip[-1] == ref[-1]) {
+                ip--;
+                ref--;
+            }
+
+            // Extend forwards
+            const u8* mp = ip + LZ_MIN_MATCH;
+            const u8* mr = ref + LZ_MIN_MATCH;
+            while (mp < match_limit && *mp == *mr) {
+                mp++;
+                mr++;
+            }
+
+            size_t lit_len = (size_t)(ip - anchor);
+            size_t match_len = (size_t)(mp - ip) - LZ_MIN_MATCH;
+            u16 offset = (u16)(ip - ref);
+
+            u8* token = op++;
+            *token = (u8)((lit_len >= 15 ? 15 : lit_len) << 4);
+            if (lit_len >= 15) op = write_length(op, lit_len - 15);
+            memcpy(op, anchor, lit_len);
+            op += lit_len;
+
+            *op++ = (u8)(offset & 0xFF);
+            *op++ = (u8)(offset >> 8);
+
+            *token |= (u8)(match_len >= 15 ? 15 : match_len);
+            if (match_len >= 15) op = write_length(op, match_len - 15);
+
+            ip = mp;
+            anchor = ip;
+        }
+    }
+
+    // Last literals
+    size_t lit_len = (size_t)(end - anchor);
+    u8* token = op++;
+    *token = (u8)((lit_len >= 15 ? 15 : lit_len) << 4);
+    if (lit_len >= 15) op = write_length(op, lit_len - 15);
+    memcpy(op, anchor, lit_len);
+    op += lit_len;
+
+    return (size_t)(op - (u8*)dst);
+}
+
+// --- Decompression ---
+
+static bool read_length(const u8** ip, const u8* end, size_t* len) {
+    u8 b;
+    do {
+        if (*ip >= end) return false;
+        b = *(*ip)++;
+        *len += b;
+    } while (b == 255);
+    return true;
+}
+
+bool sf_lz_decompress(const void* src, size_t src_size, void* dst, size_t dst_size) {
+    const u8* ip = (const u8*)src;
+    const u8* const ip_end = ip + src_size;
+    u8* op = (u8*)dst;
+    u8* const op_start = op;
+    u8* const op_end = op + dst_size;
+
+    while (ip < ip_end) {
+        u8 token = *ip++;
+
+        size_t lit_len = token >> 4;
+        if (lit_len == 15 && !read_length(&ip, ip_end, &lit_len)) return false;
+        if (lit_len > (size_t)(ip_end - ip) || lit_len > (size_t)(op_end - op)) return false;
+        memcpy(op, ip, lit_len);
+        ip += lit_len;
+        op += lit_len;
+
+        // The final sequence carries only literals
+        if (ip == ip_end) break;
+
+        if (ip_end - ip < 2) return false;
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - op_start)) return false;
+
+        size_t match_len = token & 0x0F;
+        if (match_len == 15 && !read_length(&ip, ip_end, &match_len)) return false;
+        match_len += LZ_MIN_MATCH;
+        if (match_len > (size_t)(op_end - op)) return false;
+
+        // Byte copy: overlapping matches (offset < length) replicate the pattern
+        const u8* ref = op - offset;
+        if (offset >= match_len) {
+            memcpy(op, ref, match_len);
+            op += match_len;
+        } else {
+            for (size_t i = 0; i < match_len; ++i) *op++ = *ref++;
+        }
+    }
+
+    return op == op_end;
+}
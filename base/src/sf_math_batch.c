@@ -0,0 +1,182 @@
+#include <sionflow/base/sf_math_batch.h>
+#include "sf_math_batch_kernels.h"
+
+// Elements per pool job. Large enough to amortize the job hand-off, small enough
+// to keep every worker busy on mid-sized batches.
+#define BATCH_JOB_SIZE 16384
+
+// --- Kernel Selection ---
+
+static sf_atomic_ptr g_kernels;
+
+static const sf_math_batch_kernel_table* kernels(void) {
+    static const sf_cpu_variant variants[] = {
+#ifdef SF_HAVE_TARGET_AVX512
+        { SF_CPU_VARIANT_AVX512, &sf_math_batch_kernels_avx512 },
+#endif
+#ifdef SF_HAVE_TARGET_AVX2
+        { SF_CPU_VARIANT_AVX2, &sf_math_batch_kernels_avx2 },
+#endif
+        { 0, &sf_math_batch_kernels },
+    };
+    return (const sf_math_batch_kernel_table*)sf_cpu_select_cached(&g_kernels, variants, (uint32_t)(sizeof(variants) / sizeof(variants[0])));
+}
+
+const char* sf_math_batch_target(void) {
+    return kernels()->name;
+}
+
+// --- Range Splitting ---
+
+typedef enum {
+    BATCH_TRANSFORM,
+    BATCH_NORMALIZE3,
+    BATCH_DOT3,
+    BATCH_CROSS3,
+    BATCH_LENGTH3,
+    BATCH_MAT4_MUL,
+    BATCH_MAT4_INVERSE
+} batch_op;
+
+typedef struct {
+    const sf_math_batch_kernel_table* k;
+    batch_op op;
+    size_t count;
+    const f32* m;     // Transform matrix
+    f32 w;            // Transform w (1 = points, 0 = directions)
+    // Vector inputs, or a[0]/b[0] for matrix arrays. Unused slots alias a used
+    // array so the per-range offsets stay in bounds.
+    const f32* a[3];
+    const f32* b[3];
+    f32* out[3];
+} batch_ctx;
+
+static void run_range(const batch_ctx* ctx, size_t begin, size_t n) {
+    const f32* a[3] = { ctx->a[0] + begin, ctx->a[1] + begin, ctx->a[2] + begin };
+    const f32* b[3] = { ctx->b[0] + begin, ctx->b[1] + begin, ctx->b[2] + begin };
+    f32* out[3] = { ctx->out[0] + begin, ctx->out[1] + begin, ctx->out[2] + begin };
+
+    switch (ctx->op) {
+        case BATCH_TRANSFORM:  ctx->k->transform(ctx->m, ctx->w, a, out, n); break;
+        case BATCH_NORMALIZE3: ctx->k->normalize3(a, out, n); break;
+        case BATCH_DOT3:       ctx->k->dot3(a, b, out[0], n); break;
+        case BATCH_CROSS3:     ctx->k->cross3(a, b, out, n); break;
+        case BATCH_LENGTH3:    ctx->k->length3(a, out[0], n); break;
+        case BATCH_MAT4_MUL:
+            ctx->k->mat4_mul(ctx->a[0] + begin * 16, ctx->b[0] + begin * 16, ctx->out[0] + begin * 16, n);
+            break;
+        case BATCH_MAT4_INVERSE:
+            ctx->k->mat4_inverse(ctx->a[0] + begin * 16, ctx->out[0] + begin * 16, n);
+            break;
+    }
+}
+
+static void batch_job_entry(u32 job_idx, void* thread_local_data, void* user_data) {
+    (void)thread_local_data;
+    const batch_ctx* ctx = (const batch_ctx*)user_data;
+    size_t begin = (size_t)job_idx * BATCH_JOB_SIZE;
+    size_t n = ctx->count - begin < BATCH_JOB_SIZE ? ctx->count - begin : BATCH_JOB_SIZE;
+    run_range(ctx, begin, n);
+}
+
+static void run_batch(const sf_math_batch_exec* exec, batch_ctx* ctx) {
+    if (ctx->count == 0) return;
+    ctx->k = kernels();
+
+    size_t min_parallel = SF_MATH_BATCH_DEFAULT_MIN_PARALLEL;
+    if (exec && exec->min_parallel) min_parallel = exec->min_parallel;
+    // Matrices carry 16x the work of a vector element
+    size_t work = (ctx->op == BATCH_MAT4_MUL || ctx->op == BATCH_MAT4_INVERSE) ? ctx->count * 16 : ctx->count;
+
+    size_t jobs = (ctx->count + BATCH_JOB_SIZE - 1) / BATCH_JOB_SIZE;
+    if (exec && exec->pool && work >= min_parallel && jobs > 1 && jobs <= UINT32_MAX) {
+        sf_thread_pool_run(exec->pool, (u32)jobs, batch_job_entry, ctx);
+    } else {
+        run_range(ctx, 0, ctx->count);
+    }
+}
+
+static void set_vec(const f32* dst[3], sf_soa3 v) {
+    dst[0] = v.x;
+    dst[1] = v.y;
+    dst[2] = v.z;
+}
+
+static void set_out(f32* dst[3], sf_soa3 v) {
+    dst[0] = v.x;
+    dst[1] = v.y;
+    dst[2] = v.z;
+}
+
+static void set_scalar_out(f32* dst[3], f32* out) {
+    dst[0] = dst[1] = dst[2] = out;
+}
+
+// --- Vector3 ---
+
+static void transform(const sf_math_batch_exec* exec, const sf_mat4* m, f32 w, sf_soa3 in, sf_soa3 out, size_t count) {
+    if (!m) return;
+    batch_ctx ctx = { .op = BATCH_TRANSFORM, .count = count, .m = m->m, .w = w };
+    set_vec(ctx.a, in);
+    set_vec(ctx.b, in);
+    set_out(ctx.out, out);
+    run_batch(exec, &ctx);
+}
+
+void sf_batch_transform_points(const sf_math_batch_exec* exec, const sf_mat4* m, sf_soa3 in, sf_soa3 out, size_t count) {
+    transform(exec, m, 1.0f, in, out, count);
+}
+
+void sf_batch_transform_dirs(const sf_math_batch_exec* exec, const sf_mat4* m, sf_soa3 in, sf_soa3 out, size_t count) {
+    transform(exec, m, 0.0f, in, out, count);
+}
+
+void sf_batch_normalize3(const sf_math_batch_exec* exec, sf_soa3 in, sf_soa3 out, size_t count) {
+    batch_ctx ctx = { .op = BATCH_NORMALIZE3, .count = count };
+    set_vec(ctx.a, in);
+    set_vec(ctx.b, in);
+    set_out(ctx.out, out);
+    run_batch(exec, &ctx);
+}
+
+void sf_batch_dot3(const sf_math_batch_exec* exec, sf_soa3 a, sf_soa3 b, f32* out, size_t count) {
+    batch_ctx ctx = { .op = BATCH_DOT3, .count = count };
+    set_vec(ctx.a, a);
+    set_vec(ctx.b, b);
+    set_scalar_out(ctx.out, out);
+    run_batch(exec, &ctx);
+}
+
+void sf_batch_cross3(const sf_math_batch_exec* exec, sf_soa3 a, sf_soa3 b, sf_soa3 out, size_t count) {
+    batch_ctx ctx = { .op = BATCH_CROSS3, .count = count };
+    set_vec(ctx.a, a);
+    set_vec(ctx.b, b);
+    set_out(ctx.out, out);
+    run_batch(exec, &ctx);
+}
+
+void sf_batch_length3(const sf_math_batch_exec* exec, sf_soa3 in, f32* out, size_t count) {
+    batch_ctx ctx = { .op = BATCH_LENGTH3, .count = count };
+    set_vec(ctx.a, in);
+    set_vec(ctx.b, in);
+    set_scalar_out(ctx.out, out);
+    run_batch(exec, &ctx);
+}
+
+// --- Matrix4 ---
+
+void sf_batch_mat4_mul(const sf_math_batch_exec* exec, const f32* a, const f32* b, f32* out, size_t count) {
+    batch_ctx ctx = { .op = BATCH_MAT4_MUL, .count = count };
+    ctx.a[0] = ctx.a[1] = ctx.a[2] = a;
+    ctx.b[0] = ctx.b[1] = ctx.b[2] = b;
+    set_scalar_out(ctx.out, out);
+    run_batch(exec, &ctx);
+}
+
+void sf_batch_mat4_inverse(const sf_math_batch_exec* exec, const f32* in, f32* out, size_t count) {
+    batch_ctx ctx = { .op = BATCH_MAT4_INVERSE, .count = count };
+    ctx.a[0] = ctx.a[1] = ctx.a[2] = in;
+    ctx.b[0] = ctx.b[1] = ctx.b[2] = in;
+    set_scalar_out(ctx.out, out);
+    run_batch(exec, &ctx);
+}
@@ -0,0 +1,125 @@
+#include "sf_math_batch_kernels.h"
+#include <sionflow/base/sf_math.h>
+#include "sf_simd_vec.h"
+
+// Lanes perform exactly the operations of the scalar tail (and of sf_math), in the same
+// order, so every target produces the same bits.
+
+// --- Vector3 ---
+
+static void k_transform(const f32* m, f32 w, const f32* const in[3], f32* const out[3], size_t n) {
+    // Same sum as sf_mat4_mul_vec4: ((x*c0 + y*c1) + z*c2) + w*c3, per row
+    const f32 wx = w * m[12], wy = w * m[13], wz = w * m[14];
+    size_t i = 0;
+#ifdef SF_SIMD_VECTOR
+    for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) {
+        vf32 x = v_load(in[0] + i), y = v_load(in[1] + i), z = v_load(in[2] + i);
+        v_store(out[0] + i, x * m[0] + y * m[4] + z * m[8] + wx);
+        v_store(out[1] + i, x * m[1] + y * m[5] + z * m[9] + wy);
+        v_store(out[2] + i, x * m[2] + y * m[6] + z * m[10] + wz);
+    }
+#endif
+    for (; i < n; ++i) {
+        f32 x = in[0][i], y = in[1][i], z = in[2][i];
+        out[0][i] = x * m[0] + y * m[4] + z * m[8] + wx;
+        out[1][i] = x * m[1] + y * m[5] + z * m[9] + wy;
+        out[2][i] = x * m[2] + y * m[6] + z * m[10] + wz;
+    }
+}
+
+static void k_normalize3(const f32* const in[3], f32* const out[3], size_t n) {
+    size_t i = 0;
+#ifdef SF_SIMD_VECTOR
+    const vf32 zero = { 0 };
+    for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) {
+        vf32 x = v_load(in[0] + i), y = v_load(in[1] + i), z = v_load(in[2] + i);
+        vf32 len = v_sqrt(x * x + y * y + z * z);
+        vi32 keep = len > zero; // False for 0 and NaN, like sf_vec3_normalize
+        vf32 inv_len = 1.0f / len;
+        v_store(out[0] + i, v_keep(x * inv_len, keep));
+        v_store(out[1] + i, v_keep(y * inv_len, keep));
+        v_store(out[2] + i, v_keep(z * inv_len, keep));
+    }
+#endif
+    for (; i < n; ++i) {
+        sf_vec3 v = sf_vec3_normalize((sf_vec3){ in[0][i], in[1][i], in[2][i] });
+        out[0][i] = v.x;
+        out[1][i] = v.y;
+        out[2][i] = v.z;
+    }
+}
+
+static void k_dot3(const f32* const a[3], const f32* const b[3], f32* out, size_t n) {
+    size_t i = 0;
+#ifdef SF_SIMD_VECTOR
+    for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) {
+        v_store(out + i, v_load(a[0] + i) * v_load(b[0] + i) + v_load(a[1] + i) * v_load(b[1] + i) +
+                         v_load(a[2] + i) * v_load(b[2] + i));
+    }
+#endif
+    for (; i < n; ++i) out[i] = a[0][i] * b[0][i] + a[1][i] * b[1][i] + a[2][i] * b[2][i];
+}
+
+static void k_cross3(const f32* const a[3], const f32* const b[3], f32* const out[3], size_t n) {
+    size_t i = 0;
+#ifdef SF_SIMD_VECTOR
+    for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) {
+        vf32 ax = v_load(a[0] + i), ay = v_load(a[1] + i), az = v_load(a[2] + i);
+        vf32 bx = v_load(b[0] + i), by = v_load(b[1] + i), bz = v_load(b[2] + i);
+        v_store(out[0] + i, ay * bz - az * by);
+        v_store(out[1] + i, az * bx - ax * bz);
+        v_store(out[2] + i, ax * by - ay * bx);
+    }
+#endif
+    for (; i < n; ++i) {
+        f32 ax = a[0][i], ay = a[1][i], az = a[2][i];
+        f32 bx = b[0][i], by = b[1][i], bz = b[2][i];
+        out[0][i] = ay * bz - az * by;
+        out[1][i] = az * bx - ax * bz;
+        out[2][i] = ax * by - ay * bx;
+    }
+}
+
+static void k_length3(const f32* const in[3], f32* out, size_t n) {
+    size_t i = 0;
+#ifdef SF_SIMD_VECTOR
+    for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) {
+        vf32 x = v_load(in[0] + i), y = v_load(in[1] + i), z = v_load(in[2] + i);
+        v_store(out + i, v_sqrt(x * x + y * y + z * z));
+    }
+#endif
+    for (; i < n; ++i) out[i] = sqrtf(in[0][i] * in[0][i] + in[1][i] * in[1][i] + in[2][i] * in[2][i]);
+}
+
+// --- Matrix4 ---
+// One matrix is already a full SIMD problem; sf_math picks SSE/AVX/NEON for this target.
+
+static void k_mat4_mul(const f32* a, const f32* b, f32* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        sf_mat4 ma, mb;
+        memcpy(ma.m, a + i * 16, sizeof(ma.m));
+        memcpy(mb.m, b + i * 16, sizeof(mb.m));
+        sf_mat4 r = sf_mat4_mul(ma, mb);
+        memcpy(out + i * 16, r.m, sizeof(r.m));
+    }
+}
+
+static void k_mat4_inverse(const f32* in, f32* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        sf_mat4 m;
+        memcpy(m.m, in + i * 16, sizeof(m.m));
+        sf_mat4 r = sf_mat4_inverse(m);
+        memcpy(out + i * 16, r.m, sizeof(r.m));
+    }
+}
+
+const sf_math_batch_kernel_table SF_TARGET_SYMBOL(sf_math_batch_kernels) = {
+    .name = SF_SIMD_TARGET_NAME,
+    .transform = k_transform,
+    .normalize3 = k_normalize3,
+    .dot3 = k_dot3,
+    .cross3 = k_cross3,
+    .length3 = k_length3,
+    .mat4_mul = k_mat4_mul,
+    .mat4_inverse = k_mat4_inverse,
+};
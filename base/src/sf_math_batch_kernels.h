@@ -0,0 +1,28 @@
+#ifndef SF_MATH_BATCH_KERNELS_H
+#define SF_MATH_BATCH_KERNELS_H
+
+#include <sionflow/base/sf_types.h>
+#include <sionflow/base/sf_platform.h>
+
+// Range kernels of sf_math_batch, one table per target ISA (see sf_simd_vec.h).
+// Vector arguments are {x, y, z} component arrays, already offset to the range.
+typedef struct {
+    const char* name;
+    void (*transform)(const f32* m, f32 w, const f32* const in[3], f32* const out[3], size_t n);
+    void (*normalize3)(const f32* const in[3], f32* const out[3], size_t n);
+    void (*dot3)(const f32* const a[3], const f32* const b[3], f32* out, size_t n);
+    void (*cross3)(const f32* const a[3], const f32* const b[3], f32* const out[3], size_t n);
+    void (*length3)(const f32* const in[3], f32* out, size_t n);
+    void (*mat4_mul)(const f32* a, const f32* b, f32* out, size_t n);
+    void (*mat4_inverse)(const f32* in, f32* out, size_t n);
+} sf_math_batch_kernel_table;
+
+extern const sf_math_batch_kernel_table sf_math_batch_kernels;
+#ifdef SF_HAVE_TARGET_AVX2
+extern const sf_math_batch_kernel_table sf_math_batch_kernels_avx2;
+#endif
+#ifdef SF_HAVE_TARGET_AVX512
+extern const sf_math_batch_kernel_table sf_math_batch_kernels_avx512;
+#endif
+
+#endif // SF_MATH_BATCH_KERNELS_H
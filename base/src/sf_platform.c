@@ -1,9 +1,16 @@
 #include <sionflow/base/sf_platform.h>
+#include <sionflow/base/sf_atomic.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+    #include <cpuid.h>
+#elif defined(__aarch64__) && defined(__linux__)
+    #include <sys/auxv.h>
+#endif
+
 #ifdef _WIN32
 #include <direct.h>
 
@@ -92,6 +99,109 @@ void sf_atomic_store(sf_atomic_i32* var, int32_t val) {
     InterlockedExchange(var, val);
 }
 
+// --- Time Windows ---
+
+uint64_t sf_time_now_ns(void) {
+    static LARGE_INTEGER freq;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    // Split to avoid overflowing 64 bits for long uptimes
+    uint64_t sec = (uint64_t)(now.QuadPart / freq.QuadPart);
+    uint64_t rem = (uint64_t)(now.QuadPart % freq.QuadPart);
+    return sec * 1000000000ull + rem * 1000000000ull / (uint64_t)freq.QuadPart;
+}
+
+// --- File Mapping Windows ---
+
+bool sf_file_map_open(sf_file_map* map, const char* path, sf_file_map_advice advice) {
+    if (!map || !path) return false;
+    memset(map, 0, sizeof(sf_file_map));
+
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (advice == SF_FILE_MAP_ADVICE_SEQUENTIAL) flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    else if (advice == SF_FILE_MAP_ADVICE_RANDOM) flags |= FILE_FLAG_RANDOM_ACCESS;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    map->data = view;
+    map->size = (size_t)size.QuadPart;
+    map->file = file;
+    map->mapping = mapping;
+
+    if (advice == SF_FILE_MAP_ADVICE_WILLNEED) {
+        sf_file_map_advise(map, 0, map->size, advice);
+    }
+    return true;
+}
+
+void sf_file_map_advise(const sf_file_map* map, size_t offset, size_t size, sf_file_map_advice advice) {
+    if (!map || !map->data || offset >= map->size) return;
+    if (size > map->size - offset) size = map->size - offset;
+
+#if _WIN32_WINNT >= 0x0602
+    if (advice == SF_FILE_MAP_ADVICE_WILLNEED) {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = (void*)((const char*)map->data + offset);
+        range.NumberOfBytes = size;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    (void)size; (void)advice;
+#endif
+}
+
+void sf_file_map_close(sf_file_map* map) {
+    if (!map) return;
+    if (map->data) UnmapViewOfFile(map->data);
+    if (map->mapping) CloseHandle(map->mapping);
+    if (map->file) CloseHandle(map->file);
+    memset(map, 0, sizeof(sf_file_map));
+}
+
+// --- Executable Memory Windows ---
+
+void* sf_exec_mem_alloc(size_t size) {
+    if (size == 0) return NULL;
+    return VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+}
+
+bool sf_exec_mem_seal(void* ptr, size_t size) {
+    DWORD old;
+    if (!ptr || !VirtualProtect(ptr, size, PAGE_EXECUTE_READ, &old)) return false;
+    return FlushInstructionCache(GetCurrentProcess(), ptr, size) != 0;
+}
+
+void sf_exec_mem_free(void* ptr, size_t size) {
+    (void)size;
+    if (ptr) VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
 // --- FS Windows ---
 
 bool sf_fs_mkdir(const char* path) {
@@ -128,6 +238,9 @@ bool sf_fs_clear_dir(const char* path) {
 #include <sys/types.h>
 #include <dirent.h>
 #include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 
 // --- Linux/POSIX Implementation ---
 
@@ -192,6 +305,104 @@ void sf_atomic_store(sf_atomic_i32* var, int32_t val) {
     atomic_store(var, val);
 }
 
+// --- Time POSIX ---
+
+uint64_t sf_time_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// --- File Mapping POSIX ---
+
+static int posix_madvise_flag(sf_file_map_advice advice) {
+    switch (advice) {
+        case SF_FILE_MAP_ADVICE_SEQUENTIAL: return POSIX_MADV_SEQUENTIAL;
+        case SF_FILE_MAP_ADVICE_RANDOM:     return POSIX_MADV_RANDOM;
+        case SF_FILE_MAP_ADVICE_WILLNEED:   return POSIX_MADV_WILLNEED;
+        case SF_FILE_MAP_ADVICE_DONTNEED:   return POSIX_MADV_DONTNEED;
+        default:                            return POSIX_MADV_NORMAL;
+    }
+}
+
+bool sf_file_map_open(sf_file_map* map, const char* path, sf_file_map_advice advice) {
+    if (!map || !path) return false;
+    memset(map, 0, sizeof(sf_file_map));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+
+    if (st.st_size == 0) {
+        close(fd);
+        return true;
+    }
+
+    void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    map->data = view;
+    map->size = (size_t)st.st_size;
+
+    if (advice != SF_FILE_MAP_ADVICE_NORMAL) {
+        sf_file_map_advise(map, 0, map->size, advice);
+    }
+    return true;
+}
+
+void sf_file_map_advise(const sf_file_map* map, size_t offset, size_t size, sf_file_map_advice advice) {
+    if (!map || !map->data || offset >= map->size) return;
+    if (size > map->size - offset) size = map->size - offset;
+
+    // Round the range out to page boundaries
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    uintptr_t begin = (uintptr_t)map->data + offset;
+    uintptr_t end = begin + size;
+    begin &= ~(uintptr_t)(page - 1);
+    end = (end + page - 1) & ~(uintptr_t)(page - 1);
+
+#if defined(__linux__) && defined(MADV_DONTNEED)
+    // glibc's POSIX_MADV_DONTNEED is a no-op. On a read-only private file mapping
+    // MADV_DONTNEED drops the pages for real; the next touch faults them back from the file.
+    if (advice == SF_FILE_MAP_ADVICE_DONTNEED) {
+        madvise((void*)begin, (size_t)(end - begin), MADV_DONTNEED);
+        return;
+    }
+#endif
+    posix_madvise((void*)begin, (size_t)(end - begin), posix_madvise_flag(advice));
+}
+
+void sf_file_map_close(sf_file_map* map) {
+    if (!map) return;
+    if (map->data) munmap((void*)map->data, map->size);
+    memset(map, 0, sizeof(sf_file_map));
+}
+
+// --- Executable Memory POSIX ---
+
+void* sf_exec_mem_alloc(size_t size) {
+    if (size == 0) return NULL;
+    void* mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return mem == MAP_FAILED ? NULL : mem;
+}
+
+bool sf_exec_mem_seal(void* ptr, size_t size) {
+    if (!ptr || mprotect(ptr, size, PROT_READ | PROT_EXEC) != 0) return false;
+    __builtin___clear_cache((char*)ptr, (char*)ptr + size);
+    return true;
+}
+
+void sf_exec_mem_free(void* ptr, size_t size) {
+    if (ptr) munmap(ptr, size);
+}
+
 // --- FS POSIX ---
 
 bool sf_fs_mkdir(const char* path) {
@@ -216,4 +427,190 @@ bool sf_fs_clear_dir(const char* path) {
     return true;
 }
 
-#endif
\ No newline at end of file
+#endif
+
+// --- Cycle Counter (Common) ---
+
+static sf_atomic_i64 g_cycles_freq = 0;
+
+static uint64_t calibrate_cycles_frequency(void) {
+#if defined(__aarch64__) && !defined(_MSC_VER)
+    uint64_t freq;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(freq));
+    if (freq) return freq;
+#elif !(defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+    return 1000000000ull;
+#endif
+    // Measure the counter against the monotonic clock over a short window
+    uint64_t t0 = sf_time_now_ns();
+    uint64_t c0 = sf_cycles_now();
+    uint64_t t1;
+    do {
+        t1 = sf_time_now_ns();
+    } while (t1 - t0 < 5000000ull); // 5 ms
+    uint64_t c1 = sf_cycles_now();
+
+    double hz = (double)(c1 - c0) * 1e9 / (double)(t1 - t0);
+    return hz >= 1.0 ? (uint64_t)hz : 1000000000ull;
+}
+
+uint64_t sf_cycles_frequency(void) {
+    uint64_t freq = (uint64_t)sf_atomic_load_i64(&g_cycles_freq, SF_MEMORY_ORDER_ACQUIRE);
+    if (freq == 0) {
+        // Racing threads may calibrate twice; any result is acceptable
+        freq = calibrate_cycles_frequency();
+        sf_atomic_store_i64(&g_cycles_freq, (int64_t)freq, SF_MEMORY_ORDER_RELEASE);
+    }
+    return freq;
+}
+
+uint64_t sf_cycles_to_ns(uint64_t cycles) {
+    uint64_t freq = sf_cycles_frequency();
+    uint64_t sec = cycles / freq;
+    uint64_t rem = cycles % freq;
+    return sec * 1000000000ull + (uint64_t)((double)rem * 1e9 / (double)freq);
+}
+
+// --- CPU Features (Common) ---
+
+#define CPU_FEATURES_VALID (1 << 30) // Distinguishes "detected, nothing found" from "not detected yet"
+
+static sf_atomic_i32 g_cpu_features = 0;
+static sf_atomic_i32 g_cpu_feature_mask = -1;
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+
+static void cpuid(uint32_t leaf, uint32_t sub, uint32_t r[4]) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)sub);
+    for (int i = 0; i < 4; ++i) r[i] = (uint32_t)info[i];
+#else
+    if (!__get_cpuid_count(leaf, sub, &r[0], &r[1], &r[2], &r[3])) r[0] = r[1] = r[2] = r[3] = 0;
+#endif
+}
+
+// XCR0: register state the OS saves on context switches
+static uint64_t read_xcr0(void) {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+static uint32_t detect_cpu_features(void) {
+    uint32_t r[4];
+    cpuid(0, 0, r);
+    uint32_t max_leaf = r[0];
+    if (max_leaf < 1) return 0;
+
+    uint32_t f = 0;
+    cpuid(1, 0, r);
+    uint32_t ecx1 = r[2];
+    if (r[3] & (1u << 26)) f |= SF_CPU_SSE2;
+    if (ecx1 & (1u << 19)) f |= SF_CPU_SSE41;
+    if (ecx1 & (1u << 20)) f |= SF_CPU_SSE42;
+
+    // AVX state needs OSXSAVE and XMM|YMM enabled in XCR0; AVX-512 also opmask/ZMM
+    uint64_t xcr0 = (ecx1 & (1u << 27)) ? read_xcr0() : 0;
+    bool ymm = (xcr0 & 0x6) == 0x6;
+    bool zmm = (xcr0 & 0xE6) == 0xE6;
+    if (!ymm) return f;
+
+    if (ecx1 & (1u << 28)) f |= SF_CPU_AVX;
+    if (ecx1 & (1u << 12)) f |= SF_CPU_FMA;
+    if (ecx1 & (1u << 29)) f |= SF_CPU_F16C;
+    if (max_leaf >= 7) {
+        cpuid(7, 0, r);
+        if (r[1] & (1u << 5)) f |= SF_CPU_AVX2;
+        if (zmm) {
+            if (r[1] & (1u << 16)) f |= SF_CPU_AVX512F;
+            if (r[1] & (1u << 30)) f |= SF_CPU_AVX512BW;
+            if (r[1] & (1u << 31)) f |= SF_CPU_AVX512VL;
+        }
+    }
+    return f;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+static uint32_t detect_cpu_features(void) {
+    uint32_t f = SF_CPU_NEON; // Mandatory in AArch64
+#if defined(__APPLE__)
+    f |= SF_CPU_ARM_CRC32 | SF_CPU_ARM_FP16 | SF_CPU_ARM_DOTPROD; // Every Apple Silicon core
+#elif defined(__linux__)
+    unsigned long hw = getauxval(AT_HWCAP);
+    if (hw & (1ul << 7)) f |= SF_CPU_ARM_CRC32;                  // HWCAP_CRC32
+    if ((hw & (3ul << 9)) == (3ul << 9)) f |= SF_CPU_ARM_FP16;  // HWCAP_FPHP | HWCAP_ASIMDHP
+    if (hw & (1ul << 20)) f |= SF_CPU_ARM_DOTPROD;              // HWCAP_ASIMDDP
+#elif defined(_WIN32)
+    if (IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE)) f |= SF_CPU_ARM_CRC32;
+    #ifdef PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE
+    if (IsProcessorFeaturePresent(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE)) f |= SF_CPU_ARM_DOTPROD;
+    #endif
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+    f |= SF_CPU_ARM_CRC32; // Baseline of this build
+#endif
+    return f;
+}
+
+#else
+
+static uint32_t detect_cpu_features(void) { return 0; }
+
+#endif
+
+uint32_t sf_cpu_features(void) {
+    int32_t f = sf_atomic_load_i32(&g_cpu_features, SF_MEMORY_ORDER_RELAXED);
+    if (f == 0) {
+        // Racing threads detect the same value
+        f = (int32_t)detect_cpu_features() | CPU_FEATURES_VALID;
+        sf_atomic_store_i32(&g_cpu_features, f, SF_MEMORY_ORDER_RELAXED);
+    }
+    return (uint32_t)(f & ~CPU_FEATURES_VALID) & (uint32_t)sf_atomic_load_i32(&g_cpu_feature_mask, SF_MEMORY_ORDER_RELAXED);
+}
+
+void sf_cpu_set_feature_mask(uint32_t mask) {
+    sf_atomic_store_i32(&g_cpu_feature_mask, (int32_t)mask, SF_MEMORY_ORDER_RELAXED);
+}
+
+const char* sf_cpu_feature_name(uint32_t feature) {
+    switch (feature) {
+        case SF_CPU_SSE2:        return "sse2";
+        case SF_CPU_SSE41:       return "sse4.1";
+        case SF_CPU_SSE42:       return "sse4.2";
+        case SF_CPU_AVX:         return "avx";
+        case SF_CPU_AVX2:        return "avx2";
+        case SF_CPU_FMA:         return "fma";
+        case SF_CPU_F16C:        return "f16c";
+        case SF_CPU_AVX512F:     return "avx512f";
+        case SF_CPU_AVX512BW:    return "avx512bw";
+        case SF_CPU_AVX512VL:    return "avx512vl";
+        case SF_CPU_NEON:        return "neon";
+        case SF_CPU_ARM_CRC32:   return "crc32";
+        case SF_CPU_ARM_FP16:    return "fp16";
+        case SF_CPU_ARM_DOTPROD: return "dotprod";
+        default:                 return NULL;
+    }
+}
+
+const void* sf_cpu_select(const sf_cpu_variant* variants, uint32_t count) {
+    if (!variants) return NULL;
+    uint32_t features = sf_cpu_features();
+    for (uint32_t i = 0; i < count; ++i) {
+        if ((variants[i].required & features) == variants[i].required) return variants[i].table;
+    }
+    return NULL;
+}
+
+const void* sf_cpu_select_cached(sf_atomic_ptr* cache, const sf_cpu_variant* variants, uint32_t count) {
+    const void* table = sf_atomic_load_ptr(cache, SF_MEMORY_ORDER_ACQUIRE);
+    if (table) return table;
+    table = sf_cpu_select(variants, count);
+    sf_atomic_store_ptr(cache, (void*)table, SF_MEMORY_ORDER_RELEASE);
+    return table;
+}
@@ -0,0 +1,150 @@
+#include <sionflow/base/sf_ring.h>
+#include <sionflow/base/sf_log.h>
+#include <string.h>
+
+static bool is_pow2(u32 v) {
+    return v > 0 && (v & (v - 1)) == 0;
+}
+
+// --- SPSC ---
+
+size_t sf_spsc_ring_calc_size(u32 capacity, u32 elem_size) {
+    return (size_t)capacity * elem_size;
+}
+
+bool sf_spsc_ring_init(sf_spsc_ring* ring, void* backing_buffer, u32 capacity, u32 elem_size) {
+    if (!ring || !backing_buffer || elem_size == 0) return false;
+    if (!is_pow2(capacity)) {
+        SF_LOG_ERROR("SPSC Ring: capacity %u is not a power of two", capacity);
+        return false;
+    }
+
+    ring->data = (u8*)backing_buffer;
+    ring->capacity = capacity;
+    ring->mask = capacity - 1;
+    ring->elem_size = elem_size;
+    sf_atomic_store_i64(&ring->head, 0, SF_MEMORY_ORDER_RELAXED);
+    sf_atomic_store_i64(&ring->tail, 0, SF_MEMORY_ORDER_RELAXED);
+    ring->cached_head = 0;
+    ring->cached_tail = 0;
+    return true;
+}
+
+bool sf_spsc_ring_push(sf_spsc_ring* ring, const void* elem) {
+    i64 tail = sf_atomic_load_i64(&ring->tail, SF_MEMORY_ORDER_RELAXED);
+
+    // Only re-read the consumer position when the cached one says "full"
+    if (tail - ring->cached_head >= (i64)ring->capacity) {
+        ring->cached_head = sf_atomic_load_i64(&ring->head, SF_MEMORY_ORDER_ACQUIRE);
+        if (tail - ring->cached_head >= (i64)ring->capacity) return false;
+    }
+
+    memcpy(ring->data + (size_t)(tail & ring->mask) * ring->elem_size, elem, ring->elem_size);
+    sf_atomic_store_i64(&ring->tail, tail + 1, SF_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+bool sf_spsc_ring_pop(sf_spsc_ring* ring, void* out_elem) {
+    i64 head = sf_atomic_load_i64(&ring->head, SF_MEMORY_ORDER_RELAXED);
+
+    if (head >= ring->cached_tail) {
+        ring->cached_tail = sf_atomic_load_i64(&ring->tail, SF_MEMORY_ORDER_ACQUIRE);
+        if (head >= ring->cached_tail) return false;
+    }
+
+    memcpy(out_elem, ring->data + (size_t)(head & ring->mask) * ring->elem_size, ring->elem_size);
+    sf_atomic_store_i64(&ring->head, head + 1, SF_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+u32 sf_spsc_ring_count(sf_spsc_ring* ring) {
+    i64 head = sf_atomic_load_i64(&ring->head, SF_MEMORY_ORDER_ACQUIRE);
+    i64 tail = sf_atomic_load_i64(&ring->tail, SF_MEMORY_ORDER_ACQUIRE);
+    return tail > head ? (u32)(tail - head) : 0;
+}
+
+// --- MPMC ---
+
+// Each cell is [sequence (i64) | element], padded to 8 bytes.
+static u32 mpmc_cell_stride(u32 elem_size) {
+    return (u32)((sizeof(sf_atomic_i64) + elem_size + 7) & ~(size_t)7);
+}
+
+static sf_atomic_i64* mpmc_cell_seq(sf_mpmc_ring* ring, i64 pos) {
+    return (sf_atomic_i64*)(ring->cells + (size_t)(pos & ring->mask) * ring->cell_stride);
+}
+
+size_t sf_mpmc_ring_calc_size(u32 capacity, u32 elem_size) {
+    return (size_t)capacity * mpmc_cell_stride(elem_size);
+}
+
+bool sf_mpmc_ring_init(sf_mpmc_ring* ring, void* backing_buffer, u32 capacity, u32 elem_size) {
+    if (!ring || !backing_buffer || elem_size == 0) return false;
+    if (!is_pow2(capacity)) {
+        SF_LOG_ERROR("MPMC Ring: capacity %u is not a power of two", capacity);
+        return false;
+    }
+    if (((uintptr_t)backing_buffer & 7) != 0) {
+        SF_LOG_ERROR("MPMC Ring: backing buffer must be 8-byte aligned");
+        return false;
+    }
+
+    ring->cells = (u8*)backing_buffer;
+    ring->capacity = capacity;
+    ring->mask = capacity - 1;
+    ring->elem_size = elem_size;
+    ring->cell_stride = mpmc_cell_stride(elem_size);
+
+    for (u32 i = 0; i < capacity; ++i) {
+        sf_atomic_store_i64(mpmc_cell_seq(ring, i), (i64)i, SF_MEMORY_ORDER_RELAXED);
+    }
+    sf_atomic_store_i64(&ring->enqueue_pos, 0, SF_MEMORY_ORDER_RELAXED);
+    sf_atomic_store_i64(&ring->dequeue_pos, 0, SF_MEMORY_ORDER_RELAXED);
+    return true;
+}
+
+bool sf_mpmc_ring_push(sf_mpmc_ring* ring, const void* elem) {
+    i64 pos = sf_atomic_load_i64(&ring->enqueue_pos, SF_MEMORY_ORDER_RELAXED);
+    sf_atomic_i64* seq_ptr;
+
+    while (true) {
+        seq_ptr = mpmc_cell_seq(ring, pos);
+        i64 seq = sf_atomic_load_i64(seq_ptr, SF_MEMORY_ORDER_ACQUIRE);
+        i64 dif = seq - pos;
+
+        if (dif == 0) {
+            if (sf_atomic_cas_i64(&ring->enqueue_pos, &pos, pos + 1, SF_MEMORY_ORDER_RELAXED, SF_MEMORY_ORDER_RELAXED)) break;
+        } else if (dif < 0) {
+            return false; // Full
+        } else {
+            pos = sf_atomic_load_i64(&ring->enqueue_pos, SF_MEMORY_ORDER_RELAXED);
+        }
+    }
+
+    memcpy((u8*)seq_ptr + sizeof(sf_atomic_i64), elem, ring->elem_size);
+    sf_atomic_store_i64(seq_ptr, pos + 1, SF_MEMORY_ORDER_RELEASE);
+    return true;
+}
+
+bool sf_mpmc_ring_pop(sf_mpmc_ring* ring, void* out_elem) {
+    i64 pos = sf_atomic_load_i64(&ring->dequeue_pos, SF_MEMORY_ORDER_RELAXED);
+    sf_atomic_i64* seq_ptr;
+
+    while (true) {
+        seq_ptr = mpmc_cell_seq(ring, pos);
+        i64 seq = sf_atomic_load_i64(seq_ptr, SF_MEMORY_ORDER_ACQUIRE);
+        i64 dif = seq - (pos + 1);
+
+        if (dif == 0) {
+            if (sf_atomic_cas_i64(&ring->dequeue_pos, &pos, pos + 1, SF_MEMORY_ORDER_RELAXED, SF_MEMORY_ORDER_RELAXED)) break;
+        } else if (dif < 0) {
+            return false; // Empty
+        } else {
+            pos = sf_atomic_load_i64(&ring->dequeue_pos, SF_MEMORY_ORDER_RELAXED);
+        }
+    }
+
+    memcpy(out_elem, (u8*)seq_ptr + sizeof(sf_atomic_i64), ring->elem_size);
+    sf_atomic_store_i64(seq_ptr, pos + (i64)ring->mask + 1, SF_MEMORY_ORDER_RELEASE);
+    return true;
+}
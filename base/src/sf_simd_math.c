@@ -0,0 +1,59 @@
+#include <sionflow/base/sf_simd_math.h>
+#include "sf_simd_math_kernels.h"
+
+// --- Kernel Selection ---
+
+static sf_atomic_ptr g_kernels;
+
+static const sf_simd_math_kernel_table* kernels(void) {
+    static const sf_cpu_variant variants[] = {
+#ifdef SF_HAVE_TARGET_AVX512
+        { SF_CPU_VARIANT_AVX512, &sf_simd_math_kernels_avx512 },
+#endif
+#ifdef SF_HAVE_TARGET_AVX2
+        { SF_CPU_VARIANT_AVX2, &sf_simd_math_kernels_avx2 },
+#endif
+        { 0, &sf_simd_math_kernels },
+    };
+    return (const sf_simd_math_kernel_table*)sf_cpu_select_cached(&g_kernels, variants, (uint32_t)(sizeof(variants) / sizeof(variants[0])));
+}
+
+const char* sf_simd_math_target(void) {
+    return kernels()->name;
+}
+
+// --- Unary ---
+
+void sf_simd_sin(const f32* x, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->sin(x, out, count, precision == SF_MATH_PRECISION_FAST);
+}
+
+void sf_simd_cos(const f32* x, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->cos(x, out, count, precision == SF_MATH_PRECISION_FAST);
+}
+
+void sf_simd_exp(const f32* x, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->exp(x, out, count, precision == SF_MATH_PRECISION_FAST);
+}
+
+void sf_simd_log(const f32* x, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->log(x, out, count, precision == SF_MATH_PRECISION_FAST);
+}
+
+void sf_simd_sqrt(const f32* x, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->sqrt(x, out, count, precision == SF_MATH_PRECISION_FAST);
+}
+
+void sf_simd_rsqrt(const f32* x, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->rsqrt(x, out, count, precision == SF_MATH_PRECISION_FAST);
+}
+
+// --- Binary ---
+
+void sf_simd_atan2(const f32* y, const f32* x, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->atan2(y, x, out, count, precision == SF_MATH_PRECISION_FAST);
+}
+
+void sf_simd_pow(const f32* x, const f32* y, f32* out, size_t count, sf_math_precision precision) {
+    if (count) kernels()->pow(x, y, out, count, precision == SF_MATH_PRECISION_FAST);
+}
@@ -0,0 +1,373 @@
+#include "sf_simd_math_kernels.h"
+#include "sf_simd_vec.h"
+#include <float.h>
+
+// Precise polynomials follow Cephes (S. Moshier); the fast ones are minimax fits of lower
+// degree on the same reduced ranges.
+
+#ifdef SF_SIMD_VECTOR
+
+#define SF_PIO2_F   1.57079637f
+#define SF_PI_F     3.14159274f
+#define SF_PI_LO_F  (-8.74227766e-8f) // pi - SF_PI_F
+
+// 2^n for n in [-126, 127]
+static inline vf32 v_pow2i(vi32 n) { return (vf32)((n + 127) << 23); }
+
+static inline vf32 v_clamp(vf32 x, f32 lo, f32 hi) {
+    x = v_select(x < lo, v_splat(lo), x);
+    return v_select(x > hi, v_splat(hi), x); // NaN passes through
+}
+
+// --- Exponential ---
+
+static inline vf32 v_exp(vf32 x, bool fast) {
+    // Saturates to +inf above ln(FLT_MAX) and to 0 below ln(2^-150)
+    vf32 xc = v_clamp(x, -104.0f, 88.75f);
+
+    // exp(x) = 2^n * exp(r), r = x - n*ln2 in [-ln2/2, ln2/2] (ln2 split so n*C1 is exact)
+    vf32 n = v_round_small(xc * 1.44269504088896341f);
+    vf32 r = xc - n * 0.693359375f;
+    r = r - n * -2.12194440e-4f;
+    vf32 z = r * r;
+
+    vf32 p;
+    if (fast) {
+        p = 8.369153676e-3f * r + 4.183382330e-2f;
+        p = p * r + 1.666652315e-1f;
+        p = p * r + 4.999974887e-1f;
+    } else {
+        p = 1.9875691500e-4f * r + 1.3981999507e-3f;
+        p = p * r + 8.3334519073e-3f;
+        p = p * r + 4.1665795894e-2f;
+        p = p * r + 1.6666665459e-1f;
+        p = p * r + 5.0000001201e-1f;
+    }
+    vf32 y = p * z + r + 1.0f;
+
+    // Two steps keep both factors normal, so subnormal results round once
+    vi32 ni = __builtin_convertvector(n, vi32);
+    vi32 n1 = ni >> 1;
+    y = (y * v_pow2i(n1)) * v_pow2i(ni - n1);
+    return v_select(x != x, x + x, y);
+}
+
+// --- Logarithm ---
+
+static inline vf32 v_log(vf32 x, bool fast) {
+    // Normalize subnormals, then x = m * 2^e with m in [sqrt(1/2), sqrt(2))
+    vi32 sub = (x > 0.0f) & (x < FLT_MIN);
+    vf32 xs = v_select(sub, x * 0x1p23f, x);
+    vi32 bits = (vi32)xs;
+    vi32 e = ((bits >> 23) & 0xFF) - 126 - (sub & 23);
+    vf32 m = (vf32)((bits & 0x007FFFFF) | 0x3F000000); // [0.5, 1)
+    vi32 small = m < 0.707106781186547524f;
+    e = e + small; // -1 where small
+    vf32 f = v_select(small, m + m, m) - 1.0f;
+    vf32 fe = __builtin_convertvector(e, vf32);
+
+    vf32 r;
+    if (fast) {
+        // log(1 + f) = 2 atanh(s), s = f / (2 + f) in [-0.172, 0.172]
+        vf32 s = f / (2.0f + f);
+        vf32 w = s * s;
+        vf32 p = 4.065708880e-1f * w + 6.666779271e-1f;
+        r = (fe * -2.12194440e-4f + (s + s + s * w * p)) + fe * 0.693359375f;
+    } else {
+        vf32 z = f * f;
+        vf32 y = 7.0376836292e-2f * f - 1.1514610310e-1f;
+        y = y * f + 1.1676998740e-1f;
+        y = y * f - 1.2420140846e-1f;
+        y = y * f + 1.4249322787e-1f;
+        y = y * f - 1.6668057665e-1f;
+        y = y * f + 2.0000714765e-1f;
+        y = y * f - 2.4999993993e-1f;
+        y = y * f + 3.3333331174e-1f;
+        y = y * f * z;
+        y = y + -2.12194440e-4f * fe;
+        y = y + -0.5f * z;
+        r = f + y;
+        r = r + 0.693359375f * fe;
+    }
+
+    r = v_select(x == INFINITY, x, r);
+    r = v_select(x == 0.0f, v_splat(-INFINITY), r);
+    r = v_select(x < 0.0f, v_splat(NAN), r);
+    return v_select(x != x, x + x, r);
+}
+
+// --- Trigonometry ---
+
+// Cephes sinf/cosf on [-pi/4, pi/4]
+static inline vf32 v_sin_poly(vf32 r, vf32 z, bool fast) {
+    vf32 p = fast ? 8.211985772e-3f * z - 1.666573503e-1f
+                  : (-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f;
+    vf32 s = p * z * r + r;
+    return v_select(r == 0.0f, r, s); // sin(-0) = -0
+}
+
+static inline vf32 v_cos_poly(vf32 z, bool fast) {
+    vf32 p = fast ? -1.373694391e-3f * z + 4.166549909e-2f
+                  : (2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f;
+    vf32 y = p * z * z;
+    y = y - 0.5f * z;
+    return y + 1.0f;
+}
+
+// sin(x) for quadrant offset 0, cos(x) for offset 1
+static inline vf32 v_sincos(vf32 x, i32 offset, bool fast) {
+    vf32 ax = v_abs(x);
+    vi32 huge = ax > 1.0e6f; // Includes +-inf
+    vf32 r;
+    vi32 q;
+
+    if (fast) {
+        // Cody-Waite in f32: n*DP1 and n*DP2 are exact for |n| < 2^13
+        vf32 qf = v_round_small(x * 0.636619772367581343f);
+        r = ((x - qf * 1.5703125f) - qf * 4.837512969970703125e-4f) - qf * 7.54978995489188216e-8f;
+        q = __builtin_convertvector(qf, vi32);
+    }
+    vi32 coarse = ax > 8192.0f;
+    if (!fast || v_any(coarse)) {
+        // Reduction in f64 with a 33+53 bit pi/2: q*PIO2_1 is exact for |q| < 2^20, so r keeps
+        // full relative precision even next to multiples of pi/2
+        vf64 xd = __builtin_convertvector(v_select(huge, v_splat(0.0f), x), vf64);
+        vf64 qd = v_round_small64(xd * 6.36619772367581382433e-01);
+        vf64 rd = (xd - qd * 1.57079632673412561417e+00) - qd * 6.07710050650619224932e-11;
+        vf32 r64 = __builtin_convertvector(rd, vf32);
+        vi32 q64 = __builtin_convertvector(qd, vi32);
+        // Per lane, so results do not depend on which elements share a vector
+        r = fast ? v_select(coarse, r64, r) : r64;
+        q = fast ? (coarse & q64) | (~coarse & q) : q64;
+    }
+
+    vf32 z = r * r;
+    vf32 s = v_sin_poly(r, z, fast);
+    vf32 c = v_cos_poly(z, fast);
+    q = q + offset;
+    vf32 res = v_xor_sign(v_select((q & 1) != 0, c, s), (q & 2) << 30);
+    res = v_select(x != x, x + x, res);
+
+    if (v_any(huge)) {
+        for (int i = 0; i < SF_SIMD_LANES; ++i) {
+            if (huge[i]) res[i] = offset ? cosf(x[i]) : sinf(x[i]);
+        }
+    }
+    return res;
+}
+
+static inline vf32 v_sin(vf32 x, bool fast) { return v_sincos(x, 0, fast); }
+static inline vf32 v_cos(vf32 x, bool fast) { return v_sincos(x, 1, fast); }
+
+static inline vf32 v_atan2(vf32 y, vf32 x, bool fast) {
+    // atan2 = +-(pi - )(pi/2 - )atan(t), t = min(|x|,|y|) / max(|x|,|y|) in [0, 1].
+    // t > tan(pi/8) goes through pi/4 + atan((t-1)/(t+1)).
+    vf32 ay = v_abs(y), ax = v_abs(x);
+    vi32 swap = ay > ax;
+    vi32 both_inf = (ax == INFINITY) & (ay == INFINITY);
+    vi32 x_neg = v_sign(x) != 0; // Includes -0
+    vf32 num = v_select(swap, ax, ay);
+    vf32 den = v_select(swap, ay, ax);
+    vf32 a;
+
+    if (fast) {
+        vf32 t = v_keep(num / den, den != 0.0f);      // 0/0 -> 0
+        t = v_select(both_inf, v_splat(1.0f), t);    // inf/inf -> 1
+        vi32 big = t > 0.4142135623730950f;
+        vf32 tr = v_select(big, (t - 1.0f) / (t + 1.0f), t);
+        vf32 z = tr * tr;
+        vf32 p = -1.184322638e-1f * z + 1.985219584e-1f;
+        p = p * z - 3.333198564e-1f;
+        a = v_keep(v_splat(0.785398163397448309f), big) + (p * z * tr + tr);
+        a = v_select(swap, SF_PIO2_F - a, a);
+        a = v_select(x_neg, (SF_PI_LO_F - a) + SF_PI_F, a);
+    } else {
+        // Same steps in f64 (Cephes atanf polynomial): one rounding at the end
+        vf64 nd = __builtin_convertvector(num, vf64), dd = __builtin_convertvector(den, vf64);
+        vf64 zero = { 0 };
+        vf64 t = v_select64(dd != 0.0, nd / dd, zero);
+        t = v_select64(__builtin_convertvector(both_inf, vi64), zero + 1.0, t);
+        vi64 big = t > 0.41421356237309504880;
+        vf64 tr = v_select64(big, (t - 1.0) / (t + 1.0), t);
+        vf64 z = tr * tr;
+        vf64 p = 8.05374449538e-2 * z - 1.38776856032e-1;
+        p = p * z + 1.99777106478e-1;
+        p = p * z - 3.33329491539e-1;
+        vf64 ad = v_select64(big, zero + 0.78539816339744830962, zero) + (p * z * tr + tr);
+        ad = v_select64(__builtin_convertvector(swap, vi64), 1.57079632679489661923 - ad, ad);
+        ad = v_select64(__builtin_convertvector(x_neg, vi64), 3.14159265358979323846 - ad, ad);
+        a = __builtin_convertvector(ad, vf32);
+    }
+    a = v_xor_sign(a, v_sign(y)); // a >= 0: copysign
+    return v_select((x != x) | (y != y), x + y, a);
+}
+
+// --- Power ---
+
+// |x|^y in f64: log and exp carry ~1e-14 relative error, so the f32 result is
+// within one rounding of exact
+static inline vf32 v_pow_abs_f64(vf32 ax, vf32 y) {
+    vf64 xd = __builtin_convertvector(ax, vf64);
+    vf64 yd = __builtin_convertvector(y, vf64);
+
+    vi64 bits = (vi64)xd;
+    vi64 e = ((bits >> 52) & 0x7FF) - 1023;
+    vf64 m = (vf64)((bits & 0x000FFFFFFFFFFFFFLL) | 0x3FF0000000000000LL); // [1, 2)
+    vi64 big = m > 1.41421356237309504880;
+    m = v_select64(big, m * 0.5, m);
+    e = e - big; // +1 where big
+
+    // log(m) = 2 atanh(s), |s| <= 0.172
+    vf64 s = (m - 1.0) / (m + 1.0);
+    vf64 w = s * s;
+    vf64 p = w * (1.0 / 13.0) + 1.0 / 11.0;
+    p = p * w + 1.0 / 9.0;
+    p = p * w + 1.0 / 7.0;
+    p = p * w + 1.0 / 5.0;
+    p = p * w + 1.0 / 3.0;
+    vf64 l = __builtin_convertvector(e, vf64) * 6.93147180559945286227e-01 + (s + s) * (p * w + 1.0);
+
+    vf64 t = yd * l;
+    t = v_select64(t < -110.0, (vf64){ 0 } - 110.0, t); // Past the f32 range either way
+    t = v_select64(t > 90.0, (vf64){ 0 } + 90.0, t);
+
+    vf64 n = v_round_small64(t * 1.44269504088896338700e+00);
+    vf64 r = (t - n * 6.93147180369123816490e-01) - n * 1.90821492927058770002e-10;
+    vf64 q = r * (1.0 / 39916800.0) + 1.0 / 3628800.0; // Taylor to r^11, |r| <= 0.347
+    q = q * r + 1.0 / 362880.0;
+    q = q * r + 1.0 / 40320.0;
+    q = q * r + 1.0 / 5040.0;
+    q = q * r + 1.0 / 720.0;
+    q = q * r + 1.0 / 120.0;
+    q = q * r + 1.0 / 24.0;
+    q = q * r + 1.0 / 6.0;
+    q = q * r + 0.5;
+    q = q * r + 1.0;
+    q = q * r + 1.0;
+    vf64 scale = (vf64)((__builtin_convertvector(n, vi64) + 1023) << 52);
+    return __builtin_convertvector(q * scale, vf32);
+}
+
+static inline vf32 v_pow(vf32 x, vf32 y, bool fast) {
+    vf32 ax = v_abs(x), ay = v_abs(y);
+    // Fast keeps the precise log: its error is scaled by y
+    vf32 r = fast ? v_exp(y * v_log(ax, false), true) : v_pow_abs_f64(ax, y);
+
+    // Integer and odd-integer y (every |y| >= 2^24 is an even integer)
+    vi32 y_small = ay < 0x1p24f;
+    vf32 ys = v_keep(y, y_small);
+    vi32 yi = __builtin_convertvector(ys, vi32);
+    vi32 y_int = __builtin_convertvector(yi, vf32) == ys;
+    vi32 y_odd = y_small & y_int & ((yi & 1) != 0);
+
+    // C99 Annex F special cases, in increasing precedence
+    r = v_select(ax == 0.0f, v_select(y < 0.0f, v_splat(INFINITY), v_splat(0.0f)), r);
+    r = v_select(ax == INFINITY, v_select(y < 0.0f, v_splat(0.0f), v_splat(INFINITY)), r);
+    r = v_select((x < 0.0f) & (ax != INFINITY) & ~y_int & (ay != INFINITY), v_splat(NAN), r);
+    r = v_xor_sign(r, v_sign(x) & y_odd);
+    r = v_select((x != x) | (y != y), x + y, r);
+    r = v_select((y == 0.0f) | (x == 1.0f) | ((ax == 1.0f) & (ay == INFINITY)), v_splat(1.0f), r);
+    return r;
+}
+
+// --- Roots ---
+
+static inline vf32 v_sqrt_k(vf32 x, bool fast) { (void)fast; return v_sqrt(x); }
+
+static inline vf32 v_rsqrt(vf32 x, bool fast) {
+    if (!fast) return 1.0f / v_sqrt(x);
+
+    // Bit estimate and two Newton steps
+    vf32 r = (vf32)(0x5F375A86 - ((vi32)x >> 1));
+    vf32 hx = 0.5f * x;
+    r = r * (1.5f - hx * r * r);
+    r = r * (1.5f - hx * r * r);
+    vi32 normal = (x >= FLT_MIN) & (x < INFINITY);
+    if (v_any(~normal)) r = v_select(normal, r, 1.0f / v_sqrt(x));
+    return r;
+}
+
+// --- Stream Kernels ---
+
+// The tail runs through one padded vector, so every element takes the vector path
+#define SF__SIMD_UNARY_KERNEL(name, vfn) \
+    static void name(const f32* x, f32* out, size_t n, bool fast) { \
+        size_t i = 0; \
+        if (fast) { \
+            for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) v_store(out + i, vfn(v_load(x + i), true)); \
+        } else { \
+            for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) v_store(out + i, vfn(v_load(x + i), false)); \
+        } \
+        if (i < n) { \
+            f32 buf[SF_SIMD_LANES]; \
+            for (size_t k = 0; k < SF_SIMD_LANES; ++k) buf[k] = i + k < n ? x[i + k] : 1.0f; \
+            v_store(buf, vfn(v_load(buf), fast)); \
+            memcpy(out + i, buf, (n - i) * sizeof(f32)); \
+        } \
+    }
+
+#define SF__SIMD_BINARY_KERNEL(name, vfn) \
+    static void name(const f32* a, const f32* b, f32* out, size_t n, bool fast) { \
+        size_t i = 0; \
+        if (fast) { \
+            for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) v_store(out + i, vfn(v_load(a + i), v_load(b + i), true)); \
+        } else { \
+            for (; i + SF_SIMD_LANES <= n; i += SF_SIMD_LANES) v_store(out + i, vfn(v_load(a + i), v_load(b + i), false)); \
+        } \
+        if (i < n) { \
+            f32 ba[SF_SIMD_LANES], bb[SF_SIMD_LANES]; \
+            for (size_t k = 0; k < SF_SIMD_LANES; ++k) { \
+                ba[k] = i + k < n ? a[i + k] : 1.0f; \
+                bb[k] = i + k < n ? b[i + k] : 1.0f; \
+            } \
+            v_store(ba, vfn(v_load(ba), v_load(bb), fast)); \
+            memcpy(out + i, ba, (n - i) * sizeof(f32)); \
+        } \
+    }
+
+#else // Scalar fallback: libm
+
+#define SF__SIMD_UNARY_KERNEL(name, fn) \
+    static void name(const f32* x, f32* out, size_t n, bool fast) { \
+        (void)fast; \
+        for (size_t i = 0; i < n; ++i) out[i] = fn(x[i]); \
+    }
+
+#define SF__SIMD_BINARY_KERNEL(name, fn) \
+    static void name(const f32* a, const f32* b, f32* out, size_t n, bool fast) { \
+        (void)fast; \
+        for (size_t i = 0; i < n; ++i) out[i] = fn(a[i], b[i]); \
+    }
+
+static inline f32 rsqrt_scalar(f32 x) { return 1.0f / sqrtf(x); }
+
+#define v_sin    sinf
+#define v_cos    cosf
+#define v_exp    expf
+#define v_log    logf
+#define v_sqrt_k sqrtf
+#define v_rsqrt  rsqrt_scalar
+#define v_atan2  atan2f
+#define v_pow    powf
+#endif
+
+SF__SIMD_UNARY_KERNEL(k_sin, v_sin)
+SF__SIMD_UNARY_KERNEL(k_cos, v_cos)
+SF__SIMD_UNARY_KERNEL(k_exp, v_exp)
+SF__SIMD_UNARY_KERNEL(k_log, v_log)
+SF__SIMD_UNARY_KERNEL(k_sqrt, v_sqrt_k)
+SF__SIMD_UNARY_KERNEL(k_rsqrt, v_rsqrt)
+SF__SIMD_BINARY_KERNEL(k_atan2, v_atan2)
+SF__SIMD_BINARY_KERNEL(k_pow, v_pow)
+
+const sf_simd_math_kernel_table SF_TARGET_SYMBOL(sf_simd_math_kernels) = {
+    .name = SF_SIMD_TARGET_NAME,
+    .sin = k_sin,
+    .cos = k_cos,
+    .exp = k_exp,
+    .log = k_log,
+    .sqrt = k_sqrt,
+    .rsqrt = k_rsqrt,
+    .atan2 = k_atan2,
+    .pow = k_pow,
+};
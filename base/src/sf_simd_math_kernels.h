@@ -0,0 +1,31 @@
+#ifndef SF_SIMD_MATH_KERNELS_H
+#define SF_SIMD_MATH_KERNELS_H
+
+#include <sionflow/base/sf_types.h>
+#include <sionflow/base/sf_platform.h>
+
+// Stream kernels of sf_simd_math, one table per target ISA (see sf_simd_vec.h).
+typedef void (*sf_simd_unary_kernel)(const f32* x, f32* out, size_t n, bool fast);
+typedef void (*sf_simd_binary_kernel)(const f32* a, const f32* b, f32* out, size_t n, bool fast);
+
+typedef struct {
+    const char* name;
+    sf_simd_unary_kernel sin;
+    sf_simd_unary_kernel cos;
+    sf_simd_unary_kernel exp;
+    sf_simd_unary_kernel log;
+    sf_simd_unary_kernel sqrt;
+    sf_simd_unary_kernel rsqrt;
+    sf_simd_binary_kernel atan2; // (y, x)
+    sf_simd_binary_kernel pow;   // (x, y)
+} sf_simd_math_kernel_table;
+
+extern const sf_simd_math_kernel_table sf_simd_math_kernels;
+#ifdef SF_HAVE_TARGET_AVX2
+extern const sf_simd_math_kernel_table sf_simd_math_kernels_avx2;
+#endif
+#ifdef SF_HAVE_TARGET_AVX512
+extern const sf_simd_math_kernel_table sf_simd_math_kernels_avx512;
+#endif
+
+#endif // SF_SIMD_MATH_KERNELS_H
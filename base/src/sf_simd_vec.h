@@ -0,0 +1,96 @@
+#ifndef SF_SIMD_VEC_H
+#define SF_SIMD_VEC_H
+
+#include <sionflow/base/sf_types.h>
+#include <string.h>
+#include <math.h>
+
+// Portable vector types for the multi-versioned kernel units (sf_math_batch_kernels.c,
+// sf_simd_math_kernels.c, sf_gemm_kernels.c). Each unit is compiled once for the baseline
+// and once per sf_add_multiversion target, exporting its function table under
+// SF_TARGET_SYMBOL; the owning module lists the tables (SF_CPU_VARIANT_*) and picks one
+// on first use with sf_cpu_select_cached.
+// GCC/Clang vector extensions sized to the widest register of the target, so one source
+// becomes SSE2/NEON, AVX2 or AVX-512 code. Only IEEE operations are used, and the units
+// are built with FP contraction off, so every lane computes the same bits on every
+// target. Other compilers get SF_SIMD_VECTOR undefined and the units fall back to scalar
+// loops.
+
+// Name of the target this unit is built for ("avx2", ... or "baseline")
+#define SF__SIMD_STR2(x) #x
+#define SF__SIMD_STR(x) SF__SIMD_STR2(x)
+#ifdef SF_TARGET_NAME
+    #define SF_SIMD_TARGET_NAME SF__SIMD_STR(SF_TARGET_NAME)
+#else
+    #define SF_SIMD_TARGET_NAME "baseline"
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SF_SIMD_VECTOR 1
+    #if defined(__AVX512F__)
+        #define SF_SIMD_LANES 16
+    #elif defined(__AVX__)
+        #define SF_SIMD_LANES 8
+    #else
+        #define SF_SIMD_LANES 4
+    #endif
+    #if defined(__SSE2__) || defined(__AVX__)
+        #include <immintrin.h>
+    #elif defined(__aarch64__)
+        #include <arm_neon.h>
+    #endif
+
+typedef f32 vf32 __attribute__((vector_size(SF_SIMD_LANES * sizeof(f32))));
+typedef i32 vi32 __attribute__((vector_size(SF_SIMD_LANES * sizeof(f32))));
+typedef f64 vf64 __attribute__((vector_size(SF_SIMD_LANES * sizeof(f64))));
+typedef i64 vi64 __attribute__((vector_size(SF_SIMD_LANES * sizeof(f64))));
+typedef u32 vu32 __attribute__((vector_size(SF_SIMD_LANES * sizeof(f32)))); // Wrapping integer math
+typedef f32 vf32x4 __attribute__((vector_size(4 * sizeof(f32))));          // One 4-float row on any target
+
+static inline vf32 v_load(const f32* p) { vf32 v; memcpy(&v, p, sizeof(v)); return v; }
+static inline void v_store(f32* p, vf32 v) { memcpy(p, &v, sizeof(v)); }
+
+static inline vf32 v_splat(f32 s) {
+    vf32 v;
+    for (int i = 0; i < SF_SIMD_LANES; ++i) v[i] = s;
+    return v;
+}
+
+static inline vf32 v_sqrt(vf32 a) {
+#if SF_SIMD_LANES == 16
+    return (vf32)_mm512_sqrt_ps((__m512)a);
+#elif SF_SIMD_LANES == 8
+    return (vf32)_mm256_sqrt_ps((__m256)a);
+#elif defined(__SSE2__)
+    return (vf32)_mm_sqrt_ps((__m128)a);
+#elif defined(__aarch64__)
+    return (vf32)vsqrtq_f32((float32x4_t)a);
+#else
+    for (int i = 0; i < SF_SIMD_LANES; ++i) a[i] = sqrtf(a[i]);
+    return a;
+#endif
+}
+
+// Masks are lane-wide all-ones / all-zeros, as produced by vector comparisons
+static inline vf32 v_select(vi32 mask, vf32 a, vf32 b) { return (vf32)((mask & (vi32)a) | (~mask & (vi32)b)); }
+static inline vf32 v_keep(vf32 v, vi32 mask) { return (vf32)((vi32)v & mask); }
+static inline vf32 v_abs(vf32 a) { return (vf32)((vi32)a & 0x7FFFFFFF); }
+static inline vi32 v_sign(vf32 a) { return (vi32)a & (i32)0x80000000; }
+static inline vf32 v_xor_sign(vf32 a, vi32 sign) { return (vf32)((vi32)a ^ sign); }
+
+static inline bool v_any(vi32 mask) {
+    i32 r = 0;
+    for (int i = 0; i < SF_SIMD_LANES; ++i) r |= mask[i];
+    return r != 0;
+}
+
+// Round to nearest integer value (ties to even) for |a| < 2^22
+static inline vf32 v_round_small(vf32 a) { return (a + 0x1.8p23f) - 0x1.8p23f; }
+
+// vf64 is twice the register width, so its helpers are macros: GCC warns (-Wpsabi)
+// about functions that pass vectors wider than the enabled ISA
+#define v_select64(mask, a, b) ((vf64)(((mask) & (vi64)(a)) | (~(mask) & (vi64)(b))))
+#define v_round_small64(a) (((a) + 0x1.8p52) - 0x1.8p52)
+#endif
+
+#endif // SF_SIMD_VEC_H
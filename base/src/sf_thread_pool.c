@@ -2,6 +2,43 @@
 #include <sionflow/base/sf_log.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Anonymous batches get keys above every u32 client_id, one per submission
+#define ANON_CLIENT_BASE (1ull << 32)
+
+// A submitted batch. Lives on the stack of the submitting thread until
+// all of its jobs are finished and no worker references it anymore.
+typedef struct sf_pool_batch {
+    sf_thread_job_func job_fn;
+    void* user_data;
+    u32 total_jobs;
+    u64 client_key;               // client_id, or ANON_CLIENT_BASE + sequence number
+    int lane;
+
+    sf_atomic_i32 next_job_idx;
+    sf_atomic_i32 completed_count;
+
+    // Protected by pool->mutex
+    int attached;                 // Workers currently pulling jobs from this batch
+    bool linked;                  // Still present in its priority lane
+    struct sf_pool_batch* next;
+
+    // Timing (only when 'timed')
+    bool timed;
+    u64 submit_ns;
+    u64 first_start_ns;           // Written by the worker that claims job 0
+    u64 last_claim_ns;            // Written by the worker that claims the last job
+    u64 done_ns;                  // Protected by pool->mutex
+    u64* worker_busy_ns;          // [num_threads], protected by pool->mutex
+} sf_pool_batch;
+
+// Padded to a cache line: each slot is only written by its own worker.
+typedef struct {
+    sf_thread_worker_stats s;
+    u8 pad[64 - sizeof(sf_thread_worker_stats) % 64];
+} sf_worker_slot;
 
 struct sf_thread_pool {
     int num_threads;
@@ -14,18 +51,24 @@ struct sf_thread_pool {
     
     bool running;
     
-    // Batch State
-    u32 total_jobs;
-    sf_atomic_i32 next_job_idx;
-    sf_atomic_i32 completed_count;
+    // Scheduling State (protected by mutex)
+    sf_pool_batch* lanes[SF_THREAD_PRIORITY_COUNT];
     
-    sf_thread_job_func job_fn;
-    void* job_user_data;
+    // Bumped on every submission so busy workers return to the scheduler
+    // and rebalance (higher priority work or a new client).
+    sf_atomic_i32 sched_epoch;
+
+    u64 anon_clients;             // Anonymous batches submitted so far (protected by mutex)
 
     // Callbacks
     sf_thread_init_func init_fn;
     sf_thread_cleanup_func cleanup_fn;
     void* init_user_data;
+
+    // Statistics (protected by mutex)
+    bool stats_enabled;
+    sf_worker_slot* worker_stats;
+    sf_thread_pool_stats stats;
 };
 
 typedef struct {
@@ -33,6 +76,73 @@ typedef struct {
     int thread_idx;
 } worker_arg;
 
+// Scratch stack of a worker: one buffer per nesting level, levels below 'depth' are held
+typedef struct {
+    void* data[SF_THREAD_POOL_SCRATCH_DEPTH];
+    size_t size[SF_THREAD_POOL_SCRATCH_DEPTH];
+    u32 depth;
+} sf_worker_scratch;
+
+#ifdef _MSC_VER
+static __declspec(thread) sf_worker_scratch* tls_scratch;
+#else
+static _Thread_local sf_worker_scratch* tls_scratch;
+#endif
+
+static bool batch_exhausted(sf_pool_batch* batch) {
+    return sf_atomic_load(&batch->next_job_idx) >= (int32_t)batch->total_jobs;
+}
+
+static bool batch_finished(sf_pool_batch* batch) {
+    return sf_atomic_load(&batch->completed_count) >= (int32_t)batch->total_jobs && batch->attached == 0;
+}
+
+// Must be called with pool->mutex held.
+static void unlink_batch(sf_thread_pool* pool, sf_pool_batch* batch) {
+    if (!batch->linked) return;
+    sf_pool_batch** it = &pool->lanes[batch->lane];
+    while (*it) {
+        if (*it == batch) {
+            *it = batch->next;
+            break;
+        }
+        it = &(*it)->next;
+    }
+    batch->next = NULL;
+    batch->linked = false;
+}
+
+// Picks the next batch to work on. Must be called with pool->mutex held.
+// Highest priority lane wins. Within a lane the client with the fewest attached
+// workers is preferred; ties go to the oldest batch (FIFO).
+static sf_pool_batch* pick_batch(sf_thread_pool* pool) {
+    for (int lane = 0; lane < SF_THREAD_PRIORITY_COUNT; ++lane) {
+        sf_pool_batch* best = NULL;
+        int best_load = 0;
+
+        sf_pool_batch* it = pool->lanes[lane];
+        while (it) {
+            sf_pool_batch* next = it->next;
+            if (batch_exhausted(it)) {
+                unlink_batch(pool, it);
+            } else {
+                int load = 0;
+                for (sf_pool_batch* other = pool->lanes[lane]; other; other = other->next) {
+                    if (other->client_key == it->client_key) load += other->attached;
+                }
+                if (!best || load < best_load) {
+                    best = it;
+                    best_load = load;
+                }
+            }
+            it = next;
+        }
+
+        if (best) return best;
+    }
+    return NULL;
+}
+
 static void* worker_entry(void* arg) {
     worker_arg* warg = (worker_arg*)arg;
     sf_thread_pool* pool = warg->pool;
@@ -44,41 +154,89 @@ static void* worker_entry(void* arg) {
         thread_local_data = pool->init_fn(thread_idx, pool->init_user_data);
     }
 
+    sf_thread_worker_stats* wstats = pool->stats_enabled ? &pool->worker_stats[thread_idx].s : NULL;
+    sf_worker_scratch scratch = { 0 };
+    tls_scratch = &scratch;
+
     while (true) {
         sf_mutex_lock(&pool->mutex);
-        while (pool->running && 
-               (sf_atomic_load(&pool->next_job_idx) >= (int32_t)pool->total_jobs)) {
+        sf_pool_batch* batch = NULL;
+        u64 park_start = 0;
+        while (pool->running && !(batch = pick_batch(pool))) {
+            if (wstats && park_start == 0) park_start = sf_time_now_ns();
             sf_cond_wait(&pool->work_cond, &pool->mutex);
+            if (wstats) wstats->wakeups++;
         }
         
         if (!pool->running) {
             sf_mutex_unlock(&pool->mutex);
             break;
         }
+
+        if (wstats) {
+            if (park_start) wstats->idle_ns += sf_time_now_ns() - park_start;
+            wstats->batches_joined++;
+        }
+
+        batch->attached++;
+        int32_t epoch = sf_atomic_load(&pool->sched_epoch);
+        bool timed = batch->timed;
         sf_mutex_unlock(&pool->mutex);
         
+        // Accumulated locally, published under the mutex on detach
+        u64 busy_ns = 0;
+        u64 jobs = 0;
+
         while (true) {
-            int32_t job_id = sf_atomic_inc(&pool->next_job_idx) - 1;
+            int32_t job_id = sf_atomic_inc(&batch->next_job_idx) - 1;
             
-            if (job_id >= (int32_t)pool->total_jobs) {
+            if (job_id >= (int32_t)batch->total_jobs) {
                 break;
             }
             
-            pool->job_fn((u32)job_id, thread_local_data, pool->job_user_data);
+            if (timed || wstats) {
+                u64 t0 = sf_time_now_ns();
+                if (job_id == 0) batch->first_start_ns = t0;
+                if (job_id == (int32_t)batch->total_jobs - 1) batch->last_claim_ns = t0;
+                batch->job_fn((u32)job_id, thread_local_data, batch->user_data);
+                busy_ns += sf_time_now_ns() - t0;
+            } else {
+                batch->job_fn((u32)job_id, thread_local_data, batch->user_data);
+            }
+            jobs++;
+            sf_atomic_inc(&batch->completed_count);
             
-            int32_t finished = sf_atomic_inc(&pool->completed_count);
-            if (finished == (int32_t)pool->total_jobs) {
-                sf_mutex_lock(&pool->mutex);
-                sf_cond_signal(&pool->done_cond);
-                sf_mutex_unlock(&pool->mutex);
+            // New work arrived: go back to the scheduler to rebalance
+            if (sf_atomic_load(&pool->sched_epoch) != epoch) {
+                break;
             }
         }
+
+        sf_mutex_lock(&pool->mutex);
+        if (wstats) {
+            wstats->busy_ns += busy_ns;
+            wstats->jobs_executed += jobs;
+        }
+        if (timed && batch->worker_busy_ns) {
+            batch->worker_busy_ns[thread_idx] += busy_ns;
+        }
+        batch->attached--;
+        if (batch_exhausted(batch)) {
+            unlink_batch(pool, batch);
+        }
+        if (batch_finished(batch)) {
+            if (timed) batch->done_ns = sf_time_now_ns();
+            sf_cond_broadcast(&pool->done_cond);
+        }
+        sf_mutex_unlock(&pool->mutex);
     }
     
     if (pool->cleanup_fn) {
         pool->cleanup_fn(thread_local_data, pool->init_user_data);
     }
-    
+
+    tls_scratch = NULL;
+    for (u32 i = 0; i < SF_THREAD_POOL_SCRATCH_DEPTH; ++i) free(scratch.data[i]);
     return NULL;
 }
 
@@ -99,15 +257,21 @@ sf_thread_pool* sf_thread_pool_create(const sf_thread_pool_desc* desc) {
     sf_cond_init(&p->work_cond);
     sf_cond_init(&p->done_cond);
     
-    p->total_jobs = 0;
-    sf_atomic_store(&p->next_job_idx, 0); 
-    sf_atomic_store(&p->completed_count, 0);
+    for (int i = 0; i < SF_THREAD_PRIORITY_COUNT; ++i) p->lanes[i] = NULL;
+    sf_atomic_store(&p->sched_epoch, 0);
+    p->anon_clients = 0;
     
     p->init_fn = desc->init_fn;
     p->cleanup_fn = desc->cleanup_fn;
     p->init_user_data = desc->user_data;
-    p->job_fn = NULL;
-    p->job_user_data = NULL;
+
+    p->stats_enabled = desc->enable_stats;
+    p->worker_stats = NULL;
+    if (p->stats_enabled) {
+        p->worker_stats = calloc((size_t)n, sizeof(sf_worker_slot));
+        if (!p->worker_stats) p->stats_enabled = false;
+    }
+    memset(&p->stats, 0, sizeof(sf_thread_pool_stats));
     
     for (int i = 0; i < n; ++i) {
         worker_arg* warg = malloc(sizeof(worker_arg));
@@ -132,37 +296,181 @@ void sf_thread_pool_destroy(sf_thread_pool* pool) {
     }
     
     free(pool->threads);
+    free(pool->worker_stats);
     sf_mutex_destroy(&pool->mutex);
     sf_cond_destroy(&pool->work_cond);
     sf_cond_destroy(&pool->done_cond);
     free(pool);
 }
 
+void sf_thread_pool_submit(sf_thread_pool* pool, const sf_thread_pool_batch_desc* desc) {
+    if (!pool || !desc || desc->job_count == 0) return;
+
+    int lane = (int)desc->priority;
+    if (lane < 0 || lane >= SF_THREAD_PRIORITY_COUNT) lane = SF_THREAD_PRIORITY_NORMAL;
+
+    sf_pool_batch batch;
+    batch.job_fn = desc->job_fn;
+    batch.user_data = desc->user_data;
+    batch.total_jobs = desc->job_count;
+    batch.client_key = desc->client_id;
+    batch.lane = lane;
+    sf_atomic_store(&batch.next_job_idx, 0);
+    sf_atomic_store(&batch.completed_count, 0);
+    batch.attached = 0;
+    batch.linked = true;
+    batch.next = NULL;
+
+    batch.timed = pool->stats_enabled || desc->stats;
+    batch.submit_ns = batch.timed ? sf_time_now_ns() : 0;
+    batch.first_start_ns = batch.submit_ns;
+    batch.last_claim_ns = batch.submit_ns;
+    batch.done_ns = batch.submit_ns;
+    batch.worker_busy_ns = desc->stats ? calloc((size_t)pool->num_threads, sizeof(u64)) : NULL;
+
+    sf_mutex_lock(&pool->mutex);
+
+    if (!desc->client_id) batch.client_key = ANON_CLIENT_BASE + pool->anon_clients++;
+
+    // Append to the lane (FIFO within a client)
+    sf_pool_batch** tail = &pool->lanes[lane];
+    while (*tail) tail = &(*tail)->next;
+    *tail = &batch;
+
+    sf_atomic_inc(&pool->sched_epoch);
+    sf_cond_broadcast(&pool->work_cond);
+
+    while (!batch_finished(&batch)) {
+        sf_cond_wait(&pool->done_cond, &pool->mutex);
+    }
+    unlink_batch(pool, &batch);
+
+    if (batch.timed) {
+        u64 queue_ns = batch.first_start_ns - batch.submit_ns;
+        u64 tail_ns = batch.done_ns - batch.last_claim_ns;
+
+        if (pool->stats_enabled) {
+            pool->stats.batches_completed++;
+            pool->stats.tail_ns_total += tail_ns;
+            if (tail_ns > pool->stats.tail_ns_max) pool->stats.tail_ns_max = tail_ns;
+            if (queue_ns > pool->stats.queue_ns_max) pool->stats.queue_ns_max = queue_ns;
+        }
+
+        if (desc->stats) {
+            sf_thread_pool_batch_stats* out = desc->stats;
+            memset(out, 0, sizeof(sf_thread_pool_batch_stats));
+            out->wall_ns = batch.done_ns - batch.submit_ns;
+            out->queue_ns = queue_ns;
+            out->tail_ns = tail_ns;
+            if (batch.worker_busy_ns) {
+                for (int i = 0; i < pool->num_threads; ++i) {
+                    u64 busy = batch.worker_busy_ns[i];
+                    if (busy == 0) continue;
+                    out->busy_ns += busy;
+                    if (busy > out->busy_ns_max) out->busy_ns_max = busy;
+                    out->workers_joined++;
+                }
+            }
+            if (out->busy_ns > 0) {
+                out->imbalance_ratio = (f32)((double)out->busy_ns_max * out->workers_joined / (double)out->busy_ns);
+            }
+        }
+    }
+
+    sf_mutex_unlock(&pool->mutex);
+    free(batch.worker_busy_ns);
+}
+
 void sf_thread_pool_run(
     sf_thread_pool* pool,
     u32 job_count,
     sf_thread_job_func job_fn,
     void* user_data
 ) {
-    if (job_count == 0) return;
-    
+    sf_thread_pool_batch_desc desc = {
+        .job_count = job_count,
+        .job_fn = job_fn,
+        .user_data = user_data,
+        .priority = SF_THREAD_PRIORITY_NORMAL,
+        .client_id = 0
+    };
+    sf_thread_pool_submit(pool, &desc);
+}
+
+int sf_thread_pool_get_thread_count(sf_thread_pool* pool) {
+    return pool ? pool->num_threads : 0;
+}
+
+void* sf_thread_pool_scratch_acquire(size_t size) {
+    sf_worker_scratch* scratch = tls_scratch;
+    if (!scratch || scratch->depth == SF_THREAD_POOL_SCRATCH_DEPTH) return NULL;
+
+    // Only the free level may move; the held ones below stay put
+    u32 level = scratch->depth;
+    if (size > scratch->size[level] || !scratch->data[level]) {
+        void* data = malloc(size ? size : 1);
+        if (!data) return NULL;
+        free(scratch->data[level]);
+        scratch->data[level] = data;
+        scratch->size[level] = size;
+    }
+    scratch->depth++;
+    return scratch->data[level];
+}
+
+void sf_thread_pool_scratch_release(void* data) {
+    sf_worker_scratch* scratch = tls_scratch;
+    if (!scratch || !data) return;
+    if (scratch->depth == 0 || scratch->data[scratch->depth - 1] != data) {
+        SF_LOG_ERROR("Thread Pool: scratch %p released out of order", data);
+        return;
+    }
+    scratch->depth--;
+}
+
+// --- Statistics ---
+
+void sf_thread_pool_get_stats(sf_thread_pool* pool, sf_thread_pool_stats* out_stats) {
+    if (!out_stats) return;
+    memset(out_stats, 0, sizeof(sf_thread_pool_stats));
+    if (!pool || !pool->stats_enabled) return;
+
     sf_mutex_lock(&pool->mutex);
-    
-    pool->job_fn = job_fn;
-    pool->job_user_data = user_data;
-    pool->total_jobs = job_count;
-    sf_atomic_store(&pool->next_job_idx, 0);
-    sf_atomic_store(&pool->completed_count, 0);
-    
-    sf_cond_broadcast(&pool->work_cond);
-    
-    while (sf_atomic_load(&pool->completed_count) < (int32_t)job_count) {
-        sf_cond_wait(&pool->done_cond, &pool->mutex);
+    *out_stats = pool->stats;
+    out_stats->worker_count = pool->num_threads;
+    for (int i = 0; i < pool->num_threads; ++i) {
+        const sf_thread_worker_stats* w = &pool->worker_stats[i].s;
+        out_stats->jobs_executed += w->jobs_executed;
+        out_stats->wakeups += w->wakeups;
+        out_stats->busy_ns_total += w->busy_ns;
+        out_stats->idle_ns_total += w->idle_ns;
+        if (w->busy_ns > out_stats->busy_ns_max) out_stats->busy_ns_max = w->busy_ns;
     }
-    
     sf_mutex_unlock(&pool->mutex);
+
+    if (out_stats->busy_ns_total > 0) {
+        double mean = (double)out_stats->busy_ns_total / (double)pool->num_threads;
+        out_stats->imbalance_ratio = (f32)((double)out_stats->busy_ns_max / mean);
+    }
 }
 
-int sf_thread_pool_get_thread_count(sf_thread_pool* pool) {
-    return pool ? pool->num_threads : 0;
+int sf_thread_pool_get_worker_stats(sf_thread_pool* pool, sf_thread_worker_stats* out_stats, int max_workers) {
+    if (!pool || !pool->stats_enabled || !out_stats) return 0;
+
+    int count = pool->num_threads < max_workers ? pool->num_threads : max_workers;
+    sf_mutex_lock(&pool->mutex);
+    for (int i = 0; i < count; ++i) {
+        out_stats[i] = pool->worker_stats[i].s;
+    }
+    sf_mutex_unlock(&pool->mutex);
+    return count;
+}
+
+void sf_thread_pool_reset_stats(sf_thread_pool* pool) {
+    if (!pool || !pool->stats_enabled) return;
+
+    sf_mutex_lock(&pool->mutex);
+    memset(pool->worker_stats, 0, sizeof(sf_worker_slot) * (size_t)pool->num_threads);
+    memset(&pool->stats, 0, sizeof(sf_thread_pool_stats));
+    sf_mutex_unlock(&pool->mutex);
 }
@@ -14,6 +14,19 @@ u32 sf_fnv1a_hash(const char* str) {
     return hash;
 }
 
+u64 sf_fnv1a_hash64(const void* data, size_t size) {
+    return sf_fnv1a_hash64_update(SF_FNV1A64_INIT, data, size);
+}
+
+u64 sf_fnv1a_hash64_update(u64 hash, const void* data, size_t size) {
+    const u8* p = (const u8*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= p[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
 // --- String / Path Utils ---
 
 char* sf_arena_strdup(sf_arena* arena, const char* str) {
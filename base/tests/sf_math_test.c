@@ -0,0 +1,76 @@
+#include "sf_math_test.h"
+#include <sionflow/base/sf_platform.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// sf_math.h promises the same bits from every SIMD path as from SF_MATH_SCALAR.
+
+#define TEST_COUNT 20000
+
+typedef struct {
+    const char* name;
+    sf_math_test_fn run;
+    u32 features; // SF_CPU_* the build needs at runtime
+} math_variant;
+
+static const math_variant VARIANTS[] = {
+#ifdef SF_MATH_TEST_X86
+    { "sse", sf_math_test_run_sse, SF_CPU_SSE2 },
+    { "avx", sf_math_test_run_avx, SF_CPU_AVX },
+#else
+    { "native", sf_math_test_run_native, 0 },
+#endif
+};
+
+static u32 rng_state = 0x12345678u;
+
+static f32 rng_f32(f32 lo, f32 hi) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return lo + (hi - lo) * (f32)(rng_state >> 8) * (1.0f / 16777216.0f);
+}
+
+// Mixed scales, plus exactly singular and near-singular matrices for the identity fallbacks
+static void fill_inputs(f32* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        f32* p = in + i * SF_MATH_TEST_IN_STRIDE;
+        f32 scale = (i % 5 == 0) ? 1e-2f : (i % 5 == 1) ? 1e3f : 4.0f;
+        for (int k = 0; k < SF_MATH_TEST_IN_STRIDE; ++k) p[k] = rng_f32(-scale, scale);
+        if (i % 97 == 0) memcpy(p + 4, p, 4 * sizeof(f32));  // Repeated mat4 column
+        if (i % 89 == 0) memcpy(p + 3, p, 3 * sizeof(f32));  // Repeated mat3 column
+    }
+}
+
+int main(void) {
+    f32* in = malloc(sizeof(f32) * SF_MATH_TEST_IN_STRIDE * TEST_COUNT);
+    f32* expected = malloc(sizeof(f32) * SF_MATH_TEST_OUT_STRIDE * TEST_COUNT);
+    f32* actual = malloc(sizeof(f32) * SF_MATH_TEST_OUT_STRIDE * TEST_COUNT);
+    if (!in || !expected || !actual) return 1;
+
+    fill_inputs(in, TEST_COUNT);
+    sf_math_test_run_scalar(in, TEST_COUNT, expected);
+
+    int failures = 0;
+    for (size_t v = 0; v < sizeof(VARIANTS) / sizeof(VARIANTS[0]); ++v) {
+        if (!sf_cpu_has(VARIANTS[v].features)) {
+            printf("%-6s skipped (not supported by this CPU)\n", VARIANTS[v].name);
+            continue;
+        }
+        VARIANTS[v].run(in, TEST_COUNT, actual);
+        size_t mismatches = 0;
+        for (size_t i = 0; i < (size_t)SF_MATH_TEST_OUT_STRIDE * TEST_COUNT; ++i) {
+            if (memcmp(&expected[i], &actual[i], sizeof(f32)) == 0) continue;
+            if (mismatches++ == 0) {
+                printf("%-6s first mismatch: case %zu, output %zu: %.9g (scalar %.9g)\n", VARIANTS[v].name,
+                       i / SF_MATH_TEST_OUT_STRIDE, i % SF_MATH_TEST_OUT_STRIDE, actual[i], expected[i]);
+            }
+        }
+        printf("%-6s %zu mismatching values over %d cases\n", VARIANTS[v].name, mismatches, TEST_COUNT);
+        if (mismatches) failures++;
+    }
+
+    free(in);
+    free(expected);
+    free(actual);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,19 @@
+#ifndef SF_MATH_TEST_H
+#define SF_MATH_TEST_H
+
+#include <sionflow/base/sf_types.h>
+
+// sf_math_variant.c is compiled once per sf_math.h path; each build runs every
+// routine over the same inputs so the outputs can be compared bit for bit.
+
+#define SF_MATH_TEST_IN_STRIDE  32 // Two mat4 (a, b); the mat3/vec operands are cut from them
+#define SF_MATH_TEST_OUT_STRIDE 82 // mat4 mul, transpose, inverse, x vec4 | mat3 mul, transpose, inverse, x vec3
+
+typedef void (*sf_math_test_fn)(const f32* in, size_t count, f32* out);
+
+void sf_math_test_run_scalar(const f32* in, size_t count, f32* out);
+void sf_math_test_run_sse(const f32* in, size_t count, f32* out);
+void sf_math_test_run_avx(const f32* in, size_t count, f32* out);
+void sf_math_test_run_native(const f32* in, size_t count, f32* out);
+
+#endif // SF_MATH_TEST_H
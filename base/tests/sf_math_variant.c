@@ -0,0 +1,32 @@
+#include <sionflow/base/sf_math.h>
+#include "sf_math_test.h"
+
+// Built with SF_MATH_TEST_VARIANT=<scalar|sse|avx|native> and the matching flags
+#define SF__MATH_TEST_FN2(v) sf_math_test_run_##v
+#define SF__MATH_TEST_FN(v) SF__MATH_TEST_FN2(v)
+
+void SF__MATH_TEST_FN(SF_MATH_TEST_VARIANT)(const f32* in, size_t count, f32* out) {
+    for (size_t i = 0; i < count; ++i, in += SF_MATH_TEST_IN_STRIDE, out += SF_MATH_TEST_OUT_STRIDE) {
+        sf_mat4 a, b;
+        memcpy(a.m, in, sizeof(a.m));
+        memcpy(b.m, in + 16, sizeof(b.m));
+        sf_vec4 v4 = { in[16], in[17], in[18], in[19] };
+
+        sf_mat3 a3, b3;
+        memcpy(a3.m, in, sizeof(a3.m));
+        memcpy(b3.m, in + 16, sizeof(b3.m));
+        sf_vec3 v3 = { in[25], in[26], in[27] };
+
+        sf_mat4 m4[3] = { sf_mat4_mul(a, b), sf_mat4_transpose(a), sf_mat4_inverse(a) };
+        sf_vec4 r4 = sf_mat4_mul_vec4(a, v4);
+        sf_mat3 m3[3] = { sf_mat3_mul(a3, b3), sf_mat3_transpose(a3), sf_mat3_inverse(a3) };
+        sf_vec3 r3 = sf_mat3_mul_vec3(a3, v3);
+
+        f32* o = out;
+        for (int k = 0; k < 3; ++k, o += 16) memcpy(o, m4[k].m, sizeof(m4[k].m));
+        memcpy(o, &r4, sizeof(r4));
+        o += 4;
+        for (int k = 0; k < 3; ++k, o += 9) memcpy(o, m3[k].m, sizeof(m3[k].m));
+        memcpy(o, &r3, sizeof(r3));
+    }
+}
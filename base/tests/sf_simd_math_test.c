@@ -0,0 +1,189 @@
+#include <sionflow/base/sf_simd_math.h>
+#include <sionflow/base/sf_platform.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Checks the error table of sf_simd_math.h against f64 libm, in both precision modes.
+// Usage: sf_simd_math_test [feature mask], e.g. 0 to force the baseline kernels.
+
+#define SAMPLE_COUNT (1 << 16)
+
+typedef void (*unary_fn)(const f32* x, f32* out, size_t count, sf_math_precision precision);
+typedef void (*binary_fn)(const f32* a, const f32* b, f32* out, size_t count, sf_math_precision precision);
+
+typedef struct {
+    f32 lo, hi; // lo == hi: random bit patterns
+} sample_range;
+
+typedef struct {
+    const char* name;
+    unary_fn fn;
+    binary_fn fn2;
+    double (*ref)(double);
+    double (*ref2)(double, double);
+    double bound[SF_MATH_PRECISION_COUNT]; // ULP, or absolute error where 'absolute' is set
+    bool absolute[SF_MATH_PRECISION_COUNT];
+    u32 range_count;
+    sample_range ranges[3];
+    sample_range ranges2[3]; // Second operand of binary functions
+} math_case;
+
+static double ref_rsqrt(double x) { return 1.0 / sqrt(x); }
+
+static const math_case CASES[] = {
+    { "sin",   sf_simd_sin,   NULL, sin,       NULL, { 2.0, 5e-6 }, { false, true }, 3, { { -10, 10 }, { -1e6f, 1e6f }, { 0, 0 } }, { { 0, 0 } } },
+    { "cos",   sf_simd_cos,   NULL, cos,       NULL, { 2.0, 5e-6 }, { false, true }, 3, { { -10, 10 }, { -1e6f, 1e6f }, { 0, 0 } }, { { 0, 0 } } },
+    { "exp",   sf_simd_exp,   NULL, exp,       NULL, { 1.0, 8.0 },  { false, false }, 2, { { -110, 90 }, { 0, 0 } }, { { 0, 0 } } },
+    { "log",   sf_simd_log,   NULL, log,       NULL, { 1.0, 12.0 }, { false, false }, 2, { { 0, 4 }, { 0, 0 } }, { { 0, 0 } } },
+    { "sqrt",  sf_simd_sqrt,  NULL, sqrt,      NULL, { 0.5, 0.5 },  { false, false }, 1, { { 0, 0 } }, { { 0, 0 } } },
+    { "rsqrt", sf_simd_rsqrt, NULL, ref_rsqrt, NULL, { 1.5, 80.0 }, { false, false }, 1, { { 0, 0 } }, { { 0, 0 } } },
+    { "atan2", NULL, sf_simd_atan2, NULL, atan2, { 1.0, 40.0 }, { false, false }, 2, { { -2, 2 }, { 0, 0 } }, { { -2, 2 }, { 0, 0 } } },
+    // Fast pow: 8 + 2 * |y * log2(x)| ULP, see pow_bound
+    { "pow",   NULL, sf_simd_pow,   NULL, pow,   { 1.0, 8.0 },  { false, false }, 3, { { 0, 4 }, { -3, 3 }, { 0, 0 } }, { { -20, 20 }, { -10, 10 }, { 0, 0 } } },
+};
+
+// Inputs every function must handle as C99 Annex F says
+static const f32 SPECIALS[] = {
+    0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 2.0f, -2.0f, 3.0f, -3.0f, INFINITY, -INFINITY, NAN,
+    FLT_MAX, -FLT_MAX, FLT_MIN, -FLT_MIN, 1e-40f, -1e-40f, 1e6f, -1e6f, 1e7f, 88.5f, -104.0f,
+};
+#define SPECIAL_COUNT (sizeof(SPECIALS) / sizeof(SPECIALS[0]))
+
+static u32 rng_state = 0x9E3779B9u;
+
+static u32 rng_u32(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void fill(f32* dst, sample_range range) {
+    for (u32 i = 0; i < SAMPLE_COUNT; ++i) {
+        if (range.hi > range.lo) {
+            dst[i] = range.lo + (range.hi - range.lo) * (f32)(rng_u32() >> 8) * (1.0f / 16777216.0f);
+        } else {
+            u32 bits = rng_u32();
+            memcpy(&dst[i], &bits, sizeof(f32));
+        }
+    }
+}
+
+static double ulp_of(f32 r) {
+    f32 a = fabsf(r);
+    if (a < FLT_MIN) return ldexp(1.0, -149);
+    int e;
+    frexpf(a, &e);
+    return ldexp(1.0, e - 24);
+}
+
+static double pow_bound(const math_case* c, sf_math_precision precision, f32 x, f32 y) {
+    if (precision == SF_MATH_PRECISION_PRECISE) return c->bound[precision];
+    double scale = (double)y * log2(fabs((double)x));
+    return c->bound[precision] + (isnan(scale) ? 0.0 : 2.0 * fabs(scale)); // 0 * log2(0) is NaN
+}
+
+typedef struct {
+    double worst;
+    f32 at_x, at_y;
+    u32 failures;
+} case_result;
+
+// Checks one output against the f64 reference
+static void check(const math_case* c, sf_math_precision precision, f32 x, f32 y, f32 got, case_result* res) {
+    double ref = c->fn ? c->ref(x) : c->ref2(x, y);
+    bool ok;
+    double err = 0.0;
+    f32 ref_f = (f32)ref;
+    double bound = c->fn2 == sf_simd_pow ? pow_bound(c, precision, x, y) : c->bound[precision];
+    // Fast rsqrt only promises its bound for normal inputs
+    if (c->fn == sf_simd_rsqrt && !isnormal(x)) bound = c->bound[SF_MATH_PRECISION_PRECISE];
+
+    if (isnan(ref)) {
+        ok = isnan(got);
+    } else if (isinf(ref_f) || ref_f == 0.0f) {
+        // Exact special results (and overflow/underflow) must match, sign included
+        ok = got == ref_f && signbit(got) == signbit(ref_f);
+        // Fast pow may round to inf just below FLT_MAX (and to 0 just above the smallest subnormal)
+        if (!ok && c->fn2 == sf_simd_pow && precision == SF_MATH_PRECISION_FAST && isfinite(got)) {
+            err = fabs((double)got - ref) / ulp_of(got);
+            ok = err <= bound;
+        }
+    } else if (isinf(got) && c->fn2 == sf_simd_pow && precision == SF_MATH_PRECISION_FAST) {
+        ok = fabs(ref) + bound * ulp_of(ref_f) > FLT_MAX;
+    } else if (c->absolute[precision]) {
+        err = fabs((double)got - ref);
+        ok = err <= bound;
+    } else {
+        err = fabs((double)got - ref) / ulp_of(ref_f);
+        ok = err <= bound;
+    }
+
+    if (err > res->worst) {
+        res->worst = err;
+        res->at_x = x;
+        res->at_y = y;
+    }
+    if (!ok && res->failures++ < 3) {
+        printf("  %s %s: f(%a, %a) = %a, expected %a (bound %g)\n", c->name, sf_math_precision_to_str(precision),
+               x, y, got, ref, bound);
+    }
+}
+
+static void run_batch(const math_case* c, sf_math_precision precision, const f32* xs, const f32* ys, f32* out, size_t count, case_result* res) {
+    if (c->fn) {
+        c->fn(xs, out, count, precision);
+    } else {
+        c->fn2(xs, ys, out, count, precision);
+    }
+    for (size_t i = 0; i < count; ++i) check(c, precision, xs[i], c->fn ? 0.0f : ys[i], out[i], res);
+}
+
+static bool run_case(const math_case* c, sf_math_precision precision, f32* xs, f32* ys, f32* out) {
+    case_result res = { 0 };
+
+    for (u32 r = 0; r < c->range_count; ++r) {
+        fill(xs, c->ranges[r]);
+        if (!c->fn) fill(ys, c->ranges2[r]);
+        run_batch(c, precision, xs, ys, out, SAMPLE_COUNT, &res);
+    }
+
+    // Special values, and every pair of them for binary functions
+    size_t n = 0;
+    for (size_t i = 0; i < SPECIAL_COUNT; ++i) {
+        for (size_t j = 0; j < (c->fn ? 1 : SPECIAL_COUNT); ++j, ++n) {
+            xs[n] = SPECIALS[i];
+            ys[n] = SPECIALS[j];
+        }
+    }
+    run_batch(c, precision, xs, ys, out, n, &res);
+
+    printf("%-6s %-8s worst %.3g %s at (%a, %a): %s\n", c->name, sf_math_precision_to_str(precision), res.worst,
+           c->absolute[precision] ? "abs" : "ulp", res.at_x, res.at_y, res.failures ? "FAIL" : "ok");
+    return res.failures == 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) sf_cpu_set_feature_mask((u32)strtoul(argv[1], NULL, 0));
+    printf("target %s\n", sf_simd_math_target());
+
+    f32* xs = malloc(sizeof(f32) * SAMPLE_COUNT);
+    f32* ys = malloc(sizeof(f32) * SAMPLE_COUNT);
+    f32* out = malloc(sizeof(f32) * SAMPLE_COUNT);
+    if (!xs || !ys || !out) return 1;
+
+    int failures = 0;
+    for (u32 p = 0; p < SF_MATH_PRECISION_COUNT; ++p) {
+        for (size_t c = 0; c < sizeof(CASES) / sizeof(CASES[0]); ++c) {
+            if (!run_case(&CASES[c], (sf_math_precision)p, xs, ys, out)) failures++;
+        }
+    }
+
+    free(xs);
+    free(ys);
+    free(out);
+    return failures ? 1 : 0;
+}
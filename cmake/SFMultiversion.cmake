@@ -0,0 +1,82 @@
+# --- Multi-versioned Kernels ---
+#
+# sf_add_multiversion(<target> SOURCES <files...> TARGETS <isa...>)
+#
+# Compiles SOURCES once per instruction set in TARGETS and links the objects into
+# <target>. Each build gets SF_TARGET_NAME=<isa>, so SF_TARGET_SYMBOL(name) (see
+# sf_platform.h) yields distinct symbols, and <target> gets SF_HAVE_TARGET_<ISA>=1
+# for every variant that was built. The caller lists the variants in an
+# sf_cpu_variant table and picks one at runtime with sf_cpu_select.
+#
+# Call it after target_link_libraries(<target> ...), so the variants see the same
+# include paths. Instruction sets that do not apply to the processor are skipped.
+#   x86:     sse42, avx2 (+fma, f16c), avx512 (f, bw, vl + avx2 set)
+#   AArch64: armv82 (fp16, dotprod; NEON itself is the baseline)
+
+function(sf_add_multiversion target)
+    cmake_parse_arguments(MV "" "" "SOURCES;TARGETS" ${ARGN})
+    if(NOT MV_SOURCES OR NOT MV_TARGETS)
+        message(FATAL_ERROR "sf_add_multiversion(${target}): SOURCES and TARGETS are required")
+    endif()
+
+    string(TOLOWER "${CMAKE_SYSTEM_PROCESSOR}" arch)
+    if(arch MATCHES "^(x86_64|amd64|x64|i.86|x86)$")
+        set(is_x86 ON)
+    elseif(arch MATCHES "^(aarch64|arm64)$")
+        set(is_arm64 ON)
+    endif()
+
+    # Usage requirements and generated headers of <target> apply to every variant
+    get_target_property(libs ${target} LINK_LIBRARIES)
+    get_target_property(deps ${target} MANUALLY_ADDED_DEPENDENCIES)
+    get_target_property(pic ${target} POSITION_INDEPENDENT_CODE)
+
+    foreach(isa IN LISTS MV_TARGETS)
+        set(flags "")
+        if(isa STREQUAL "sse42" AND is_x86)
+            if(NOT MSVC)
+                set(flags -msse4.2)
+            endif()
+        elseif(isa STREQUAL "avx2" AND is_x86)
+            if(MSVC)
+                set(flags /arch:AVX2)
+            else()
+                set(flags -mavx2 -mfma -mf16c)
+            endif()
+        elseif(isa STREQUAL "avx512" AND is_x86)
+            if(MSVC)
+                set(flags /arch:AVX512)
+            else()
+                set(flags -mavx512f -mavx512bw -mavx512vl -mavx2 -mfma -mf16c)
+            endif()
+        elseif(isa STREQUAL "armv82" AND is_arm64)
+            if(NOT MSVC)
+                set(flags -march=armv8.2-a+fp16+dotprod)
+            endif()
+        else()
+            continue()
+        endif()
+
+        set(obj "${target}_${isa}")
+        add_library(${obj} OBJECT ${MV_SOURCES})
+        target_compile_options(${obj} PRIVATE ${flags})
+        target_compile_definitions(${obj} PRIVATE
+            SF_TARGET_NAME=${isa}
+            $<TARGET_PROPERTY:${target},COMPILE_DEFINITIONS>
+        )
+        target_include_directories(${obj} PRIVATE $<TARGET_PROPERTY:${target},INCLUDE_DIRECTORIES>)
+        if(libs)
+            target_link_libraries(${obj} PRIVATE ${libs})
+        endif()
+        if(deps)
+            add_dependencies(${obj} ${deps})
+        endif()
+        if(pic)
+            set_target_properties(${obj} PROPERTIES POSITION_INDEPENDENT_CODE ON)
+        endif()
+
+        string(TOUPPER "${isa}" isa_upper)
+        target_sources(${target} PRIVATE $<TARGET_OBJECTS:${obj}>)
+        target_compile_definitions(${target} PRIVATE SF_HAVE_TARGET_${isa_upper}=1)
+    endforeach()
+endfunction()
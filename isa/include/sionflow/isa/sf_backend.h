@@ -31,6 +31,7 @@ typedef void (*sf_backend_dispatch_func)(
 );
 
 // Bake function to prepare a program for execution (pre-calculates plans, etc.)
+// CPU backends can return an sf_baked_program (see sf_baked.h) built with their kernel table.
 typedef void* (*sf_backend_bake_func)(void* backend_state, const struct sf_program* program);
 
 // Cleanup function for baked program data
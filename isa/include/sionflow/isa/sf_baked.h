@@ -0,0 +1,113 @@
+#ifndef SF_BAKED_H
+#define SF_BAKED_H
+
+#include <sionflow/isa/sf_program.h>
+#include <sionflow/isa/sf_exec_ctx.h>
+#include <sionflow/base/sf_memory.h>
+
+/**
+ * SionFlow Baked Tasks
+ * Pre-decoded form of a task, shared by CPU backends. The baker resolves every
+ * instruction once to a kernel function (picked by opcode, dtype and the stride
+ * class of its operands), so running a tile is a loop of indirect calls with no
+ * opcode switch and no metadata lookups.
+ */
+
+#define SF_BAKED_MAX_OPERANDS 5 // dest + src1..src4
+
+/**
+ * @brief How an operand advances over the task domain.
+ */
+typedef enum {
+    SF_STRIDE_CONTIGUOUS = 0, // Dense in domain order: element i lives at base + i * dtype size
+    SF_STRIDE_BROADCAST,      // Every stride is 0: one value for the whole domain
+    SF_STRIDE_STRIDED,        // Anything else, walk with ctx->reg_strides
+    SF_STRIDE_CLASS_COUNT
+} sf_stride_class;
+
+typedef struct {
+    u16 reg;          // Register index (into ctx->reg_ptrs)
+    u8 stride_class;  // sf_stride_class
+    u8 dtype;         // sf_dtype
+    i32 inner_stride; // Byte stride along the innermost domain dimension
+} sf_baked_operand;
+
+typedef struct sf_baked_inst sf_baked_inst;
+
+/**
+ * @brief Kernel for one instruction over the current tile (ctx->batch_size elements).
+ * Operand base pointers are ctx->reg_ptrs[inst->ops[k].reg], already offset to the tile.
+ */
+typedef void (*sf_baked_kernel)(sf_exec_ctx* ctx, const sf_baked_inst* inst);
+
+struct sf_baked_inst {
+    sf_baked_kernel fn;
+    u16 opcode;
+    u8 operand_count;                          // dest + sources
+    u8 reserved;
+    u32 aux;                                   // SF_OP_FUSED: chain index (operands are only the dest)
+    sf_baked_operand ops[SF_BAKED_MAX_OPERANDS]; // [0] = dest
+};
+
+// Baked Task Flags
+#define SF_BAKED_TASK_CONTIGUOUS (1 << 0) // Every operand is contiguous or broadcast
+
+typedef struct {
+    const sf_task* task;
+    sf_baked_inst* insts;   // [inst_count]
+    u32 inst_count;
+    u32 reg_count;          // Register slots the task touches (sf_task_register_count)
+    u32 flags;              // SF_BAKED_TASK_*
+} sf_baked_task;
+
+typedef struct {
+    const sf_program* program;
+    sf_baked_task* tasks;   // [task_count], same order as program->tasks
+    u32 task_count;
+    u32 reg_count;          // Largest reg_count of all tasks (size of a worker's register tables)
+} sf_baked_program;
+
+/**
+ * @brief Picks the kernel for a decoded instruction (opcode, operand dtypes and stride classes).
+ * Return NULL if the backend cannot run it; baking then fails.
+ */
+typedef sf_baked_kernel (*sf_baked_resolve_func)(void* user_data, const sf_baked_inst* inst);
+
+typedef struct {
+    sf_baked_resolve_func resolve;
+    void* user_data;
+} sf_baker_desc;
+
+/**
+ * @brief Classifies how register 'reg' is walked by 'task', from the task's bindings.
+ * @param out_inner_stride Optional, receives the byte stride along the innermost dimension.
+ */
+sf_stride_class sf_task_operand_class(const sf_program* prog, const sf_task* task, u16 reg, i32* out_inner_stride);
+
+/**
+ * @brief Arena bytes sf_bake_program will consume for this program.
+ */
+size_t sf_bake_program_calc_size(const sf_program* prog);
+
+bool sf_bake_task(sf_baked_task* out, const sf_program* prog, const sf_task* task, const sf_baker_desc* desc, sf_arena* arena);
+
+/**
+ * @brief Bakes every task of a program. The result references 'prog' and lives in 'arena'.
+ */
+bool sf_bake_program(sf_baked_program* out, const sf_program* prog, const sf_baker_desc* desc, sf_arena* arena);
+
+/**
+ * @brief Runs a baked task over the tile described by ctx.
+ * Stops at the first instruction that sets ctx->error.
+ */
+static inline bool sf_baked_task_run(const sf_baked_task* task, sf_exec_ctx* ctx) {
+    const sf_baked_inst* inst = task->insts;
+    const sf_baked_inst* end = inst + task->inst_count;
+    for (; inst != end; ++inst) {
+        inst->fn(ctx, inst);
+        if (ctx->error != SF_ERROR_NONE) return false;
+    }
+    return true;
+}
+
+#endif // SF_BAKED_H
@@ -0,0 +1,200 @@
+#ifndef SF_CARTRIDGE_H
+#define SF_CARTRIDGE_H
+
+#include <sionflow/isa/sf_program.h>
+#include <sionflow/isa/sf_pipeline.h>
+#include <sionflow/base/sf_platform.h>
+#include <sionflow/base/sf_memory.h>
+#include <sionflow/base/sf_thread_pool.h>
+
+/**
+ * SionFlow Cartridge Reader
+ * Opens a .sfc container by parsing only its header. Section payloads stay
+ * in the file mapping and are paged in by the OS when first touched, so the
+ * first frame does not wait for every embedded asset to become resident.
+ */
+
+typedef enum {
+    SF_SECTION_STATE_COLD = 0,    // Never touched
+    SF_SECTION_STATE_PREFETCHED,  // Read-ahead requested
+    SF_SECTION_STATE_ACCESSED     // Returned to a consumer at least once
+} sf_section_state;
+
+typedef struct sf_cartridge {
+    sf_cartridge_header header;   // Validated copy of the on-disk header (v20 files are converted)
+    sf_section_header* sections;  // Copy of the section table, header.section_count entries
+
+    const u8* data;               // Start of the container (mapping or user memory)
+    size_t size;
+
+    sf_file_map map;              // Valid when opened from a file
+    bool owns_map;
+
+    i32 const_pool_section;       // Index of the CONST_POOL section, -1 if none
+
+    sf_atomic_i32* section_state; // sf_section_state, one per section
+} sf_cartridge;
+
+/**
+ * @brief Maps a cartridge file and validates its header and section table.
+ * No section data is read. Version 20 files are accepted and converted on the fly.
+ */
+bool sf_cartridge_open_file(sf_cartridge* cart, const char* path);
+
+/**
+ * @brief Wraps an in-memory cartridge. 'data' must outlive the reader.
+ */
+bool sf_cartridge_open_memory(sf_cartridge* cart, const void* data, size_t size);
+
+/**
+ * @brief Releases the mapping (if owned). Section pointers become invalid.
+ */
+void sf_cartridge_close(sf_cartridge* cart);
+
+/**
+ * @brief Finds a section by name (and type, unless 0). Returns -1 if not found.
+ */
+i32 sf_cartridge_find_section(const sf_cartridge* cart, const char* name, u32 type);
+
+/**
+ * @brief Returns the header of section 'index' or NULL if out of range.
+ */
+const sf_section_header* sf_cartridge_get_section_header(const sf_cartridge* cart, u32 index);
+
+/**
+ * @brief Returns a read-only pointer to the stored section payload.
+ * Pages are faulted in lazily as the consumer reads them.
+ * For compressed sections this is the chunk table + chunks; use sf_cartridge_decompress_section.
+ */
+const void* sf_cartridge_get_section(sf_cartridge* cart, u32 index, size_t* out_size);
+
+/**
+ * @brief Asks the OS to start reading a section in the background (non-blocking).
+ */
+void sf_cartridge_prefetch(sf_cartridge* cart, u32 index);
+
+/**
+ * @brief Marks a section COLD and releases its pages. On Linux the pages are dropped at
+ * once (the next access faults them back from the file); elsewhere this is only a hint.
+ */
+void sf_cartridge_evict(sf_cartridge* cart, u32 index);
+
+sf_section_state sf_cartridge_get_section_state(sf_cartridge* cart, u32 index);
+
+/**
+ * @brief Decoded size of a section (equals the stored size when uncompressed).
+ */
+size_t sf_cartridge_get_section_raw_size(const sf_cartridge* cart, u32 index);
+
+/**
+ * @brief Decodes a section into dst (at least raw size bytes). Chunks of compressed
+ * sections are decompressed in parallel on 'pool' (NULL = serial) straight into dst.
+ */
+bool sf_cartridge_decompress_section(sf_cartridge* cart, u32 index, void* dst, size_t dst_size, sf_thread_pool* pool);
+
+/**
+ * @brief Loads a PROGRAM section. desc is forwarded to sf_program_load_from_buffer_ex,
+ * so SF_PROGRAM_LOAD_IN_PLACE keeps the program tables inside the mapping.
+ * Compressed sections are first decompressed into 'arena'. If desc has no constant
+ * pool, the cartridge's CONST_POOL section is supplied automatically.
+ */
+bool sf_cartridge_load_program(sf_cartridge* cart, u32 index, sf_program* prog, sf_arena* arena, const sf_program_load_desc* desc);
+
+/**
+ * @brief Loads the source location table of a program previously loaded from section
+ * 'index'. Meant for crash reports: the table is not touched by normal loads.
+ */
+bool sf_cartridge_load_debug_info(sf_cartridge* cart, u32 index, sf_program* prog, sf_arena* arena);
+
+/**
+ * @brief Loads a binary PIPELINE section. Stored sections are used in place (no parsing,
+ * no copy); compressed ones are first inflated into 'arena'.
+ * Fails for cartridges before SF_BINARY_PIPELINE_VERSION, whose pipeline is JSON text
+ * (read it with sf_cartridge_get_section).
+ */
+bool sf_cartridge_load_pipeline(sf_cartridge* cart, u32 index, sf_pipeline* pipe, sf_arena* arena);
+
+// --- Integrity ---
+
+// Bytes hashed per job by sf_cartridge_verify (large sections are split and recombined)
+#define SF_CARTRIDGE_VERIFY_BLOCK (1024 * 1024)
+
+/**
+ * @brief Identifies the cartridge contents; usable as a cache key without reading sections.
+ * Checked against the header and section table on open. 0 if the file has no checksums (v20).
+ */
+u64 sf_cartridge_content_hash(const sf_cartridge* cart);
+
+/**
+ * @brief Recomputes the CRC32C of one section and compares it with the stored value.
+ * Sections without SF_SECTION_FLAG_CHECKSUM always pass.
+ */
+bool sf_cartridge_verify_section(sf_cartridge* cart, u32 index);
+
+/**
+ * @brief Verifies every checksummed section. The data is split into SF_CARTRIDGE_VERIFY_BLOCK
+ * jobs on 'pool' (NULL = serial) and partial CRCs are combined per section.
+ * Mismatching sections are logged. Returns true if all match.
+ */
+bool sf_cartridge_verify(sf_cartridge* cart, sf_thread_pool* pool);
+
+// --- Chunked Section Compression ---
+
+/**
+ * @brief Decodes a compressed section payload described by 'header' into dst.
+ */
+bool sf_section_decompress(const sf_section_header* header, const void* payload, void* dst, size_t dst_size, sf_thread_pool* pool);
+
+// --- Parallel Loading ---
+
+/**
+ * @brief Returns the arena bytes 'decode' will need for this section (0 if none).
+ * Arena allocations are rounded up to 16 bytes each; the total is rounded up here as well.
+ */
+typedef size_t (*sf_section_calc_size_func)(const sf_section_header* header, const void* data, size_t size, void* user_data);
+
+/**
+ * @brief Decodes one section. Runs on a pool worker, concurrently with other sections.
+ * @param arena Private sub-arena sized by calc_size; not shared with other sections.
+ * @param out_result Decoded object handed back in sf_section_load_result.result.
+ */
+typedef bool (*sf_section_decode_func)(const sf_section_header* header, const void* data, size_t size, sf_arena* arena, void** out_result, void* user_data);
+
+// Decoder for a section type (IMAGE, FONT, RAW, ...). PROGRAM sections are built in, and
+// PIPELINE sections too unless a decoder for them is given.
+typedef struct {
+    u32 type; // sf_section_type
+    sf_section_calc_size_func calc_size;
+    sf_section_decode_func decode;
+    void* user_data;
+} sf_section_decoder;
+
+typedef struct {
+    sf_thread_pool* pool;                 // NULL = load serially on the calling thread
+    const sf_section_decoder* decoders;
+    u32 decoder_count;
+    sf_program_load_desc program_desc;    // Forwarded to every PROGRAM section
+    bool verify;                          // Run sf_cartridge_verify on 'pool' before decoding
+} sf_cartridge_load_desc;
+
+typedef struct {
+    void* result;       // sf_program* / sf_pipeline* for built-in types, decoder output otherwise,
+                        // (decompressed) section data if no decoder handles the type
+    bool decoded;       // A loader ran for this section
+    bool ok;
+    size_t arena_used;  // Bytes taken from the caller's arena
+    u64 decompress_ns;  // Summed chunk decompression time (0 if stored raw)
+    u64 decode_ns;      // Wall time spent decoding this section
+} sf_section_load_result;
+
+/**
+ * @brief Decodes all sections concurrently on desc->pool.
+ * Chunks of all compressed sections are first inflated as one parallel batch into
+ * buffers from 'arena'; decoders then see the raw bytes. Per-section arena budgets are computed up front (sf_program_calc_load_size / calc_size)
+ * and carved from 'arena' serially, so workers never contend on the allocator.
+ * @param out_results Array of at least header.section_count entries.
+ * @return true if every decoded section succeeded.
+ */
+bool sf_cartridge_load_all(sf_cartridge* cart, const sf_cartridge_load_desc* desc, sf_arena* arena, sf_section_load_result* out_results);
+
+#endif // SF_CARTRIDGE_H
@@ -26,20 +26,24 @@ static inline const char* sf_exec_error_to_str(sf_exec_error err) {
 /**
  * @brief Light-weight execution context (Ephemeral).
  * Created on the stack or per-thread. Points to data in sf_state or tiled buffers.
+ * The register tables are not embedded: they cover only reg_count registers and
+ * live in one block bound with sf_exec_ctx_bind_registers (typically per-worker memory).
  */
 struct sf_exec_ctx {
-    // Flat Execution Registry (Zero-Overhead Access)
-    void* reg_ptrs[SF_MAX_REGISTERS];               // Base pointers for registers
-    int32_t reg_strides[SF_MAX_REGISTERS][SF_MAX_DIMS]; // Pre-calculated N-D byte strides for current task
-    uint8_t reg_ndims[SF_MAX_REGISTERS];           // Metadata for registers
-    uint8_t reg_dtypes[SF_MAX_REGISTERS];          // Metadata for registers
-    int32_t reg_shapes[SF_MAX_REGISTERS][SF_MAX_DIMS]; // Metadata for registers
+    // Flat Execution Registry (Zero-Overhead Access), indexed by register, [reg_count]
+    void** reg_ptrs;                        // Base pointers for registers
+    int32_t (*reg_strides)[SF_MAX_DIMS];    // Pre-calculated N-D byte strides for current task
+    uint8_t* reg_ndims;                     // Metadata for registers
+    uint8_t* reg_dtypes;                    // Metadata for registers
+    int32_t (*reg_shapes)[SF_MAX_DIMS];     // Metadata for registers
+    u32 reg_count;
     
     // Optional allocator for temporary allocations during execution
     sf_allocator* allocator; 
     
     // Execution Configuration
     u32 batch_size; 
+    u8 math_precision;             // sf_math_precision, copied from the cartridge header by the host
     
     // N-Dimensional Context
     u8 ndim;
@@ -65,7 +69,34 @@ struct sf_exec_ctx {
 
 // --- Execution Context API (Internal) ---
 
+/**
+ * @brief Resets the context. Register tables are detached (reg_count = 0).
+ */
 void sf_exec_ctx_init(sf_exec_ctx* ctx, sf_allocator* allocator);
+
+/**
+ * @brief Bytes needed for the register tables of 'reg_count' registers.
+ */
+size_t sf_exec_ctx_calc_registers_size(u32 reg_count);
+
+/**
+ * @brief Lays the register tables out in 'memory' (sf_exec_ctx_calc_registers_size bytes,
+ * 16-byte aligned) and clears them. The memory must outlive the context's use.
+ */
+void sf_exec_ctx_bind_registers(sf_exec_ctx* ctx, void* memory, u32 reg_count);
+
+/**
+ * @brief Allocates the register tables from ctx->allocator (e.g. a worker's scratch arena).
+ */
+bool sf_exec_ctx_alloc_registers(sf_exec_ctx* ctx, u32 reg_count);
+
+/**
+ * @brief Number of register slots a task touches: one past the highest register among its
+ * domain register, bindings, instruction operands (including unbound scalars) and the
+ * inputs of its FUSED chains. Sizing a context with this covers every access.
+ */
+u32 sf_task_register_count(const sf_program* prog, const sf_task* task);
+
 void* sf_exec_ctx_scratch_alloc(sf_exec_ctx* ctx, size_t size);
 sf_tensor* sf_exec_ctx_scratch_tensor(sf_exec_ctx* ctx, const sf_type_info* info);
 
@@ -0,0 +1,52 @@
+#ifndef SF_FUSED_H
+#define SF_FUSED_H
+
+#include <sionflow/isa/sf_program.h>
+#include <sionflow/base/sf_simd_math.h>
+
+/**
+ * SionFlow Fused Chains
+ * An SF_OP_FUSED instruction evaluates a chain of elementwise micro-ops (see
+ * sf_bin_fused_chain) over a small virtual register file. A backend loads the chain's
+ * inputs once per tile, keeps every intermediate in registers (or a cache-resident
+ * block) and stores only the result. This is kernel fusion without code generation;
+ * the reference evaluator below defines the semantics every backend must match.
+ *
+ * Micro-ops compute in f32. Comparisons and logic ops produce 1.0 / 0.0 and treat any
+ * non-zero operand as true. SMOOTHSTEP takes its edges as two scalar operands
+ * (edge0, edge1, x) instead of the 2-element 'edges' tensor of the instruction form.
+ * SIN, COS, SQRT, POW and ATAN2 are the sf_simd_math functions at the precision of the
+ * cartridge (sf_cartridge_header.math_precision).
+ */
+
+#define SF_FUSED_EVAL_BLOCK 64 // Elements per pass of the reference evaluator
+
+/**
+ * @brief Number of virtual register sources of a micro-op, 0 if it cannot appear in a chain.
+ */
+u8 sf_fused_op_arity(u16 opcode);
+
+/**
+ * @brief Checks chain 'chain_idx' of a program: table bounds, input registers, micro-op
+ * support and arity, and that every virtual register is written before it is read.
+ */
+bool sf_fused_chain_validate(const sf_program* prog, u32 chain_idx);
+
+/**
+ * @brief Checks every chain, and that each SF_OP_FUSED instruction references a valid one.
+ * Called by sf_program_load_from_buffer_ex.
+ */
+bool sf_program_validate_fused(const sf_program* prog);
+
+/**
+ * @brief Reference evaluator: runs a chain over 'count' f32 elements.
+ * The chain must have passed sf_fused_chain_validate; sf_program_load_from_buffer_ex
+ * validates every chain of a program, so chains of a loaded program qualify. Register
+ * indices are not checked again here.
+ * inputs[k] is the data of chain input k. Bit k of 'broadcast_mask' marks input k as a
+ * single value applied to every element. 'out' may alias an input.
+ * Returns false if prog, chain or out is NULL.
+ */
+bool sf_fused_eval_f32(const sf_program* prog, const sf_bin_fused_chain* chain, const f32* const* inputs, u32 broadcast_mask, f32* out, size_t count, sf_math_precision precision);
+
+#endif // SF_FUSED_H
@@ -0,0 +1,73 @@
+#ifndef SF_GRID_H
+#define SF_GRID_H
+
+#include <sionflow/isa/sf_program.h>
+#include <sionflow/base/sf_thread_pool.h>
+#include <sionflow/base/sf_memory.h>
+
+/**
+ * @brief Order in which the tiles of a grid are handed out to workers.
+ * Space-filling curves keep consecutively scheduled tiles spatially close,
+ * so tiles that run close in time also share cache lines.
+ */
+typedef enum {
+    SF_GRID_ORDER_ROW_MAJOR = 0, // Last dimension varies fastest (same as job_idx)
+    SF_GRID_ORDER_MORTON,        // Z-order curve over all dimensions
+    SF_GRID_ORDER_HILBERT,       // Hilbert curve over the two innermost dimensions
+    SF_GRID_ORDER_COUNT
+} sf_grid_order;
+
+/**
+ * @brief A single tile of the grid with pre-decoded N-D coordinates.
+ */
+typedef struct {
+    u32 job_idx;                   // Position in the traversal order
+    u32 tile_idx;                  // Row-major index of the tile in the grid
+    u8 ndim;
+    u32 tile_coord[SF_MAX_DIMS];   // Coordinates in tiles
+    u32 tile_offset[SF_MAX_DIMS];  // Start coordinates in elements
+    u32 tile_size[SF_MAX_DIMS];    // Active elements (clipped to the domain)
+    u32 elem_count;                // Product of tile_size
+} sf_grid_tile;
+
+/**
+ * @brief Job executed once per tile.
+ * @param tile Decoded tile (valid only for the duration of the call).
+ * @param thread_local_data Data returned by sf_thread_init_func for this worker.
+ * @param user_data Passed to sf_grid_run.
+ */
+typedef void (*sf_grid_job_func)(const sf_grid_tile* tile, void* thread_local_data, void* user_data);
+
+/**
+ * @brief Pre-computed traversal of a grid.
+ * Built once (e.g. when baking a task) and reused for every dispatch.
+ */
+typedef struct {
+    sf_grid grid;
+    u8 ndim;
+    u32 domain_shape[SF_MAX_DIMS];
+    sf_grid_order order;
+    u32* tile_order;               // [total_tiles] job_idx -> tile_idx. NULL for row-major.
+} sf_grid_plan;
+
+/**
+ * @brief Prepares a traversal plan for a grid.
+ * @param domain_shape Size of the execution domain used to clip edge tiles.
+ *                     NULL means the grid covers the domain exactly.
+ * @param arena Storage for the traversal table (unused for row-major order).
+ * @return false if the grid is inconsistent, the order unknown or the arena is exhausted.
+ */
+bool sf_grid_plan_init(sf_grid_plan* plan, const sf_grid* grid, u8 ndim, const u32* domain_shape, sf_grid_order order, sf_arena* arena);
+
+/**
+ * @brief Decodes the tile scheduled at position job_idx.
+ */
+void sf_grid_get_tile(const sf_grid_plan* plan, u32 job_idx, sf_grid_tile* out_tile);
+
+/**
+ * @brief Runs job_fn for every tile of the plan in parallel and blocks until all are finished.
+ * If pool is NULL the tiles are executed on the calling thread.
+ */
+void sf_grid_run(sf_thread_pool* pool, const sf_grid_plan* plan, sf_grid_job_func job_fn, void* user_data);
+
+#endif // SF_GRID_H
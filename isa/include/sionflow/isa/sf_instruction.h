@@ -10,7 +10,9 @@
  * Layout: [ Opcode (16) | Dest (16) | Src1 (16) | Src2 (16) | Src3 (16) | Src4 (16) ]
  * 
  * Strides are calculated by the compiler during the Analyze pass and stored 
- * directly in the instruction to minimize runtime overhead (STEP_N model).
+ * directly in the task bindings to minimize runtime overhead (STEP_N model).
+ * Only what the interpreter reads lives here (12 bytes); source locations are
+ * kept in a separate debug table (sf_instruction_loc), see sf_program.debug_locs.
  */
 typedef struct sf_instruction {
     u16 opcode;
@@ -19,9 +21,16 @@ typedef struct sf_instruction {
     u16 src2_idx;
     u16 src3_idx;
     u16 src4_idx;
-    
+} sf_instruction;
+
+_Static_assert(sizeof(sf_instruction) == 12, "sf_instruction must stay 12 bytes");
+
+/**
+ * @brief Source location of one instruction (cold, crash reports only).
+ */
+typedef struct sf_instruction_loc {
     u16 line;
     u16 column;
-} sf_instruction;
+} sf_instruction_loc;
 
 #endif // SF_INSTRUCTION_H
@@ -0,0 +1,62 @@
+#ifndef SF_JIT_H
+#define SF_JIT_H
+
+#include <sionflow/isa/sf_program.h>
+#include <sionflow/isa/sf_exec_ctx.h>
+
+/**
+ * SionFlow JIT (optional)
+ * Compiles the instruction range of an elementwise task into one native SIMD loop.
+ * Intermediates stay in vector registers, so memory is only touched to load the
+ * task's inputs and store its outputs. Currently targets x86-64 (SSE2). Anything
+ * it cannot compile (other architectures, non-f32 or strided operands, unsupported
+ * opcodes, register pressure) yields NULL and the caller keeps its interpreter.
+ */
+
+#define SF_JIT_MAX_SLOTS 32 // Distinct input/output registers per kernel
+
+/**
+ * @brief Generated code. operands[k] is the tile base pointer of slot k;
+ * processes 'count' consecutive elements.
+ */
+typedef void (*sf_jit_func)(void* const* operands, size_t count);
+
+typedef struct {
+    sf_jit_func fn;
+    u64 hash;                           // Content hash of the compiled chain (cache key)
+    u32 slot_count;
+    u16 slot_regs[SF_JIT_MAX_SLOTS];    // Register behind each operand slot
+    size_t code_size;
+} sf_jit_kernel;
+
+typedef struct sf_jit_cache sf_jit_cache;
+
+/**
+ * @brief True if this build and CPU can run generated code.
+ */
+bool sf_jit_available(void);
+
+/**
+ * @brief Creates an empty code cache. Thread-safe; kernels live until the cache is destroyed.
+ */
+sf_jit_cache* sf_jit_cache_create(void);
+void sf_jit_cache_destroy(sf_jit_cache* cache);
+
+/**
+ * @brief Returns the kernel for task->start_inst .. + inst_count, compiling it on first use.
+ * Identical chains (same opcodes, registers, dtypes and stride classes) share one kernel,
+ * across programs too. Returns NULL if the task cannot be compiled.
+ */
+const sf_jit_kernel* sf_jit_compile_task(sf_jit_cache* cache, const sf_program* prog, const sf_task* task);
+
+/**
+ * @brief Runs a kernel over the current tile: ctx->batch_size elements from ctx->reg_ptrs.
+ * The tile must be a linear run of the (contiguous) domain.
+ */
+static inline void sf_jit_kernel_run(const sf_jit_kernel* kernel, sf_exec_ctx* ctx) {
+    void* operands[SF_JIT_MAX_SLOTS];
+    for (u32 i = 0; i < kernel->slot_count; ++i) operands[i] = ctx->reg_ptrs[kernel->slot_regs[i]];
+    kernel->fn(operands, ctx->batch_size);
+}
+
+#endif // SF_JIT_H
@@ -0,0 +1,74 @@
+#ifndef SF_PIPELINE_H
+#define SF_PIPELINE_H
+
+#include <sionflow/isa/sf_program.h>
+#include <sionflow/base/sf_memory.h>
+#include <sionflow/base/sf_json.h>
+
+/**
+ * SionFlow Pipeline
+ * Execution schedule (kernels) and the resources they are bound to.
+ * The binary PIPELINE section is loaded by pointing into the section bytes and
+ * validating them once; JSON is only a build-time input (sf_pipeline_from_json).
+ */
+
+// Required alignment of the source buffer for sf_pipeline_load_from_buffer
+#define SF_PIPELINE_LOAD_ALIGNMENT 16
+
+typedef struct sf_pipeline {
+    sf_bin_pipeline_header meta;
+
+    const sf_bin_pipeline_resource* resources;
+    const sf_bin_pipeline_kernel* kernels;
+    const sf_bin_pipeline_binding* bindings;
+    const char* strings;
+    const u8* data;
+} sf_pipeline;
+
+/**
+ * @brief Resolves a string offset stored in the pipeline tables.
+ */
+static inline const char* sf_pipeline_string(const sf_pipeline* pipe, u32 offset) {
+    return pipe->strings + offset;
+}
+
+/**
+ * @brief Initial data of a resource, or NULL if it has none.
+ */
+static inline const void* sf_pipeline_resource_data(const sf_pipeline* pipe, u32 index) {
+    const sf_bin_pipeline_resource* res = &pipe->resources[index];
+    return res->data_size > 0 ? pipe->data + res->data_offset : NULL;
+}
+
+/**
+ * @brief Finds a resource by name. Returns -1 if not found.
+ */
+i32 sf_pipeline_find_resource(const sf_pipeline* pipe, const char* name);
+
+/**
+ * @brief Checks that every string offset, binding range, resource index and data
+ * range stays inside its table, so consumers can index without further checks.
+ */
+bool sf_pipeline_validate(const sf_pipeline* pipe);
+
+// --- Serialization (generated from binary_layout.json) ---
+
+size_t sf_pipeline_calc_size(const sf_pipeline* pipe);
+bool sf_pipeline_save_to_buffer(const sf_pipeline* pipe, void* buffer, size_t size);
+
+/**
+ * @brief Loads a PIPELINE section without copying or parsing.
+ * All tables point into 'buffer', which must be SF_PIPELINE_LOAD_ALIGNMENT-aligned
+ * and outlive the pipeline. Offsets and indices are validated before returning.
+ */
+bool sf_pipeline_load_from_buffer(sf_pipeline* pipe, const void* buffer, size_t size);
+
+// --- Build-time Conversion ---
+
+/**
+ * @brief Builds a pipeline from its JSON description ({"resources": [...], "kernels": [...]}).
+ * Tables, strings and initial data are allocated from 'arena'.
+ */
+bool sf_pipeline_from_json(sf_pipeline* pipe, const sf_json_value* root, sf_arena* arena);
+
+#endif // SF_PIPELINE_H
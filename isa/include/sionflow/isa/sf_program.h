@@ -4,21 +4,23 @@
 #include <sionflow/base/sf_types.h>
 #include "sf_instruction.h"
 #include "sf_tensor.h"
+#include <sionflow/isa/sf_binary_layout.h> // SF_BINARY_MAGIC, SF_BINARY_VERSION*
 
-#define SF_BINARY_MAGIC   0x4D464C57 // "MFLW"
-#define SF_BINARY_VERSION 20         // Phase 9: The Cartridge Model (Container Format)
+// First version whose PIPELINE sections are binary (sf_bin_pipeline_header)
+#define SF_BINARY_PIPELINE_VERSION SF_BINARY_VERSION_V22
 
 #define SF_MAX_SYMBOL_NAME 64
 #define SF_MAX_TITLE_NAME 128
-#define SF_MAX_SECTIONS    16
+#define SF_MAX_SECTIONS_V20 16
 
 // Section Types
 typedef enum {
     SF_SECTION_PROGRAM  = 0x01, // Compiled SionFlow Bytecode
-    SF_SECTION_PIPELINE = 0x02, // Execution schedule and resource bindings (JSON)
+    SF_SECTION_PIPELINE = 0x02, // Execution schedule and resource bindings (sf_bin_pipeline_header; JSON before v22)
     SF_SECTION_IMAGE    = 0x03, // Embedded Texture (Raw or Compressed)
     SF_SECTION_FONT     = 0x04, // Embedded SDF Font Data
     SF_SECTION_RAW      = 0x05, // Arbitrary data blob
+    SF_SECTION_CONST_POOL = 0x06, // Deduplicated constant blobs shared by all programs
 } sf_section_type;
 
 // Symbol Flags (for Port Mapping)
@@ -39,14 +41,34 @@ typedef enum {
 
 // --- Cartridge Container (Level 0) ---
 
+// Section Codecs
+typedef enum {
+    SF_SECTION_CODEC_NONE = 0, // Stored raw
+    SF_SECTION_CODEC_LZ   = 1, // Independently compressed chunks (sf_lz)
+} sf_section_codec;
+
+#define SF_SECTION_DEFAULT_CHUNK_SIZE (256 * 1024)
+
+// Section Flags
+#define SF_SECTION_FLAG_CHUNK_TABLE_U32 (1 << 0) // Chunk offsets are u32 (sections read from v20 files)
+#define SF_SECTION_FLAG_CHECKSUM        (1 << 1) // 'checksum' holds the CRC32C of the stored bytes
+
 typedef struct {
     char name[SF_MAX_SYMBOL_NAME];
-    uint32_t type;   // sf_section_type
-    uint32_t offset; // Offset from start of file
-    uint32_t size;   // Size in bytes
-    uint32_t reserved[4];
+    uint32_t type;       // sf_section_type
+    uint32_t codec;      // sf_section_codec
+    uint64_t offset;     // Offset from start of file
+    uint64_t size;       // Stored size in bytes (compressed size if codec != NONE)
+    uint64_t raw_size;   // Decoded size in bytes
+    uint32_t chunk_size; // Decoded bytes per chunk (codec != NONE)
+    uint32_t flags;      // SF_SECTION_FLAG_*
+    uint32_t checksum;   // CRC32C of the stored (possibly compressed) bytes
+    uint32_t reserved[5];
 } sf_section_header;
 
+// Compressed payload: u64 chunk_offsets[chunk_count + 1] (relative to the payload),
+// followed by the chunks. A chunk whose stored size equals its decoded size is raw.
+
 typedef struct {
     u32 magic;             // 0x4D464C57
     u32 version;           // SF_BINARY_VERSION
@@ -59,14 +81,48 @@ typedef struct {
     u8 vsync;              // 1 = Enabled
     u8 fullscreen;         // 1 = Enabled
     u8 resizable;          // 1 = Enabled
-    u8 reserved_flags[1];
+    u8 math_precision;     // sf_math_precision of SIN/COS/POW/... (0 = precise)
 
     u32 section_count;
-    sf_section_header sections[SF_MAX_SECTIONS];
+    u32 reserved_pad;         // Keeps section_table_offset 8-byte aligned
+    u64 section_table_offset; // sf_section_header[section_count], 16-byte aligned
+
+    // FNV-1a 64 of this header (with content_hash = 0) followed by the section table.
+    // The table carries every section's CRC32C, so this identifies the whole file (0 = none).
+    u64 content_hash;
 
-    u32 reserved[8];       
+    u32 reserved[6];
 } sf_cartridge_header;
 
+// --- Legacy Container (v20, read path only) ---
+
+typedef struct {
+    char name[SF_MAX_SYMBOL_NAME];
+    uint32_t type;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t codec;      // Chunk table entries are u32
+    uint32_t raw_size;
+    uint32_t chunk_size;
+    uint32_t reserved[1];
+} sf_section_header_v20;
+
+typedef struct {
+    u32 magic;
+    u32 version;           // SF_BINARY_VERSION_V20
+    char app_title[SF_MAX_TITLE_NAME];
+    u32 window_width;
+    u32 window_height;
+    u32 num_threads;
+    u8 vsync;
+    u8 fullscreen;
+    u8 resizable;
+    u8 reserved_flags[1];
+    u32 section_count;
+    sf_section_header_v20 sections[SF_MAX_SECTIONS_V20];
+    u32 reserved[8];
+} sf_cartridge_header_v20;
+
 // --- Program Section (Level 1) ---
 
 // Map Name -> Register Index
@@ -99,27 +155,82 @@ typedef struct {
 } sf_grid;
 
 // A single execution unit within a program (e.g. for a specific Output shape)
+// Fields read per dispatch come first so they share one cache line; the grid follows.
 typedef struct sf_task {
     uint32_t start_inst;
     uint32_t inst_count;
+    uint32_t binding_offset; // Offset into global binding table
+    uint32_t binding_count;  // Number of registers used in this task
     uint32_t domain_reg; // Index of the register that defines the execution domain (usually an Output)
     uint8_t strategy;    // sf_dispatch_strategy
     uint8_t flags;       // SF_TASK_FLAG_*
     uint8_t reserved[2];
     
     sf_grid grid;        // Pre-calculated execution grid
-    
-    uint32_t binding_offset; // Offset into global binding table
-    uint32_t binding_count;  // Number of registers used in this task
 } sf_task;
 
+// Legacy program tables (v20/v21 cartridges, read path only)
+typedef struct {
+    u16 opcode;
+    u16 dest_idx;
+    u16 src1_idx;
+    u16 src2_idx;
+    u16 src3_idx;
+    u16 src4_idx;
+    u16 line;
+    u16 column;
+} sf_instruction_v21;
+
+typedef struct {
+    uint32_t start_inst;
+    uint32_t inst_count;
+    uint32_t domain_reg;
+    uint8_t strategy;
+    uint8_t flags;
+    uint8_t reserved[2];
+    sf_grid grid;
+    uint32_t binding_offset;
+    uint32_t binding_count;
+} sf_task_v21;
+
+// --- Fused Chains (SF_OP_FUSED) ---
+// A FUSED instruction runs a chain of elementwise micro-ops over a small virtual
+// register file, so intermediates never leave the tile. dest_idx is the output
+// register, src1_idx the index into the chain table.
+
+#define SF_FUSED_MAX_INPUTS 8  // Program registers read by one chain
+#define SF_FUSED_MAX_VREGS  16 // Virtual registers per chain (inputs occupy v0..v[input_count - 1])
+
+// One micro-op: an atomic, linear-access opcode on virtual registers
+typedef struct {
+    uint16_t opcode;    // sf_opcode
+    uint8_t dest;       // Virtual register
+    uint8_t src[3];     // Virtual registers, in port order (unused = 0)
+    uint8_t reserved[2];
+} sf_bin_fused_op;
+
+typedef struct {
+    uint32_t op_offset; // Into the micro-op table
+    uint16_t op_count;
+    uint8_t input_count;
+    uint8_t result;     // Virtual register written to dest_idx
+    uint16_t inputs[SF_FUSED_MAX_INPUTS]; // Program registers loaded into v0..
+    uint8_t vreg_count;
+    uint8_t reserved[7];
+} sf_bin_fused_chain;
+
+// Where the initial data of a tensor lives (sf_bin_tensor_desc.is_constant)
+#define SF_TENSOR_STORAGE_NONE   0 // Uninitialized buffer
+#define SF_TENSOR_STORAGE_INLINE 1 // Program constant blobs / push constants
+#define SF_TENSOR_STORAGE_POOLED 2 // Cartridge constant pool, see pool_index
+
 // Metadata for a single tensor in the binary file
 typedef struct {
     uint8_t dtype;       // sf_dtype
     uint8_t ndim;        // Rank
-    uint8_t is_constant; // 1 if data follows, 0 if uninitialized buffer
+    uint8_t is_constant; // SF_TENSOR_STORAGE_*
     uint8_t flags;       // SF_TENSOR_FLAG_*
-    uint8_t reserved[4]; // Padding
+    uint32_t pool_index; // Blob index in the constant pool (SF_TENSOR_STORAGE_POOLED)
     
     int32_t shape[SF_MAX_DIMS];
     
@@ -138,14 +249,72 @@ typedef struct {
     u32 sync_scratch_size;      // Elements needed for sync operations
     u32 push_constants_size;    // Size in bytes of the grouped scalar constants
     
-    u32 reserved[7];       
+    u64 debug_locs_offset; // Byte offset of the sf_instruction_loc table from the section start
+    u32 debug_loc_count;   // 0 (stripped) or instruction_count
+    u32 fused_chain_count; // Entries in the fused chain table (SF_OP_FUSED)
+    u32 fused_op_count;    // Micro-ops shared by all chains
+    u32 reserved[3];
 } sf_bin_header;
 
+// --- Constant Pool Section ---
+// Header, entry table, then 64-byte aligned blobs. Identical blobs are stored once.
+
+typedef struct {
+    u32 blob_count;
+    u32 reserved[3];
+} sf_const_pool_header;
+
+typedef struct {
+    u64 offset; // From the start of the pool section
+    u64 size;   // Bytes
+    u64 hash;   // FNV-1a 64 of the blob
+    u64 reserved;
+} sf_const_pool_entry;
+
+// --- Pipeline Section ---
+// Header, resource / kernel / binding tables, string table, then 64-byte aligned initial data.
+// All names are byte offsets into the string table (NUL-terminated strings).
+
+typedef struct {
+    u32 name;            // String offset
+    u8 dtype;            // sf_dtype
+    u8 ndim;
+    u16 flags;           // SF_RESOURCE_FLAG_*
+    int32_t shape[SF_MAX_DIMS];
+    u64 data_offset;     // Into the data area
+    u64 data_size;       // Initial data in bytes (0 = uninitialized)
+} sf_bin_pipeline_resource;
+
+typedef struct {
+    u32 id;              // String offset
+    u32 entry;           // String offset, name of the PROGRAM section to run
+    u32 binding_offset;  // Into the binding table
+    u32 binding_count;
+} sf_bin_pipeline_kernel;
+
+// Program symbol (port) -> pipeline resource
+typedef struct {
+    u32 port;            // String offset
+    u32 resource;        // Resource index
+} sf_bin_pipeline_binding;
+
+// Header for a PIPELINE section
+typedef struct {
+    u32 resource_count;
+    u32 kernel_count;
+    u32 binding_count;
+    u32 string_size;     // Bytes in the string table
+    u64 data_size;       // Bytes in the initial data area
+    u32 reserved[6];
+} sf_bin_pipeline_header;
+
 // In-memory representation of a single program
 typedef struct sf_program {
     sf_bin_header meta;
     
     sf_instruction* code;
+    sf_bin_fused_chain* fused_chains; // [meta.fused_chain_count]
+    sf_bin_fused_op* fused_ops;       // [meta.fused_op_count]
     
     // Array of descriptors and initial constant data
     sf_type_info* tensor_infos;
@@ -158,6 +327,10 @@ typedef struct sf_program {
     sf_bin_task_binding* bindings;
 
     void* push_constants_data; // Pointer to the contiguous block of scalar constants
+
+    // Cold: per-instruction source locations (meta.debug_loc_count entries).
+    // NULL unless loaded with SF_PROGRAM_LOAD_DEBUG_INFO or sf_program_load_debug_info.
+    sf_instruction_loc* debug_locs;
 } sf_program;
 
 // --- Serialization (SFC 2.0) ---
@@ -166,7 +339,9 @@ typedef struct {
     const char* name;
     uint32_t type; // sf_section_type
     const void* data;
-    uint32_t size;
+    uint64_t size;
+    uint32_t codec;      // sf_section_codec (0 = store raw)
+    uint32_t chunk_size; // 0 = SF_SECTION_DEFAULT_CHUNK_SIZE
 } sf_section_desc;
 
 /**
@@ -176,6 +351,59 @@ size_t sf_program_calc_size(const sf_program* prog);
 bool sf_program_save_to_buffer(const sf_program* prog, void* buffer, size_t size);
 bool sf_program_load_from_buffer(sf_program* prog, const void* buffer, size_t size, struct sf_arena* arena);
 
+// Load Flags
+#define SF_PROGRAM_LOAD_IN_PLACE   (1 << 0) // Alias tables inside the source buffer instead of copying
+#define SF_PROGRAM_LOAD_DEBUG_INFO (1 << 1) // Also load the source location table (skipped by default)
+
+// Required alignment of the source buffer for SF_PROGRAM_LOAD_IN_PLACE (largest layout alignment)
+#define SF_PROGRAM_LOAD_ALIGNMENT 64
+
+typedef struct {
+    u32 flags; // SF_PROGRAM_LOAD_*
+
+    // Constant pool section for SF_TENSOR_STORAGE_POOLED tensors (NULL if none).
+    // Pooled tensors always point into it, so programs share the same pages.
+    const void* const_pool;
+    size_t const_pool_size;
+
+    // Cartridge version the section was written with (0 = SF_BINARY_VERSION).
+    // Older layouts are converted while loading, so their tasks and code are always copied.
+    u32 binary_version;
+} sf_program_load_desc;
+
+/**
+ * @brief Arena bytes sf_program_load_from_buffer_ex will consume for this buffer and desc.
+ * Lets callers carve exact per-program sub-arenas before loading in parallel.
+ * Returns 0 if the buffer is too small to hold a program header.
+ */
+size_t sf_program_calc_load_size(const void* buffer, size_t size, const sf_program_load_desc* desc);
+
+/**
+ * @brief Loads a program with options. desc may be NULL (same as sf_program_load_from_buffer).
+ * With SF_PROGRAM_LOAD_IN_PLACE, symbols, tasks, bindings, code, fused chains, push constants and constant
+ * blobs point into 'buffer', which must stay alive (and unmodified) for the program's lifetime
+ * and be SF_PROGRAM_LOAD_ALIGNMENT-aligned. Those tables must be treated as read-only, since
+ * the buffer may be a read-only file mapping. Only tensor_infos/tensor_data/tensor_flags are
+ * allocated from the arena.
+ */
+bool sf_program_load_from_buffer_ex(sf_program* prog, const void* buffer, size_t size, struct sf_arena* arena, const sf_program_load_desc* desc);
+
+/**
+ * @brief Loads only the source location table of an already loaded program (e.g. when
+ * writing a crash report). 'buffer' is the same section bytes the program came from.
+ * Returns false if the program was saved without debug info.
+ */
+bool sf_program_load_debug_info(sf_program* prog, const void* buffer, size_t size, struct sf_arena* arena, const sf_program_load_desc* desc);
+
+/**
+ * @brief Source location of instruction 'inst_idx', if the debug table is loaded.
+ */
+static inline bool sf_program_get_source_loc(const sf_program* prog, u32 inst_idx, sf_instruction_loc* out_loc) {
+    if (!prog->debug_locs || inst_idx >= prog->meta.debug_loc_count) return false;
+    *out_loc = prog->debug_locs[inst_idx];
+    return true;
+}
+
 /**
  * @brief Calculates total size for a full cartridge.
  * (Requires app settings from IR, but we can pass them via a simple struct or use defaults)
@@ -184,9 +412,64 @@ typedef struct {
     char app_title[SF_MAX_TITLE_NAME];
     u32 window_width; u32 window_height;
     u32 num_threads; u8 vsync; u8 fullscreen; u8 resizable;
+    u8 math_precision; // sf_math_precision
+    u32 flags; // SF_CARTRIDGE_FLAG_*
 } sf_cartridge_params;
 
+// Cartridge Build Flags
+#define SF_CARTRIDGE_FLAG_DEDUP_CONSTANTS (1 << 0) // Move constant blobs of all programs into one CONST_POOL section
+
+#define SF_CONST_POOL_SECTION_NAME "__const_pool"
+#define SF_CONST_POOL_NONE 0xFFFFFFFFu
+
+/**
+ * @brief Upper bound of the cartridge size. Exact when no section is compressed.
+ */
 size_t sf_cartridge_calc_size(const sf_cartridge_params* params, const sf_section_desc* sections, u32 section_count);
 bool sf_cartridge_save_to_buffer(const sf_cartridge_params* params, const sf_section_desc* sections, u32 section_count, void* buffer, size_t size);
 
+/**
+ * @brief Same as sf_cartridge_save_to_buffer, but reports the bytes actually written
+ * (smaller than sf_cartridge_calc_size when sections are compressed).
+ */
+bool sf_cartridge_save_to_buffer_ex(const sf_cartridge_params* params, const sf_section_desc* sections, u32 section_count, void* buffer, size_t size, size_t* out_written);
+
+/**
+ * @brief Writer that sizes and saves the same cartridge without repeating work: constant
+ * blobs are hashed and deduplicated once, in create. 'sections' (and the programs they
+ * point to) must stay alive and unchanged until the writer is destroyed.
+ * The functions above are one-shot wrappers around it.
+ * Returns NULL on allocation failure.
+ */
+typedef struct sf_cartridge_writer sf_cartridge_writer;
+
+sf_cartridge_writer* sf_cartridge_writer_create(const sf_cartridge_params* params, const sf_section_desc* sections, u32 section_count);
+void sf_cartridge_writer_destroy(sf_cartridge_writer* writer);
+size_t sf_cartridge_writer_calc_size(const sf_cartridge_writer* writer);
+bool sf_cartridge_writer_save(const sf_cartridge_writer* writer, void* buffer, size_t size, size_t* out_written);
+
+/**
+ * @brief FNV-1a 64 of 'header' (content_hash treated as 0) and its section table.
+ */
+u64 sf_cartridge_calc_content_hash(const sf_cartridge_header* header, const sf_section_header* sections);
+
+/**
+ * @brief Returns blob 'index' of a CONST_POOL section payload, or NULL if out of range.
+ */
+const void* sf_const_pool_get_blob(const void* pool, size_t pool_size, u32 index, u64* out_size);
+
+// --- Chunked Section Compression ---
+
+/**
+ * @brief Worst-case stored size of a compressed section (chunk table included).
+ */
+size_t sf_section_compress_bound(size_t raw_size, u32 chunk_size);
+
+/**
+ * @brief Splits 'raw' into chunk_size pieces and compresses each independently.
+ * Chunks that do not shrink are stored raw.
+ * @return Stored size, or 0 if dst_capacity is too small.
+ */
+size_t sf_section_compress(const void* raw, size_t raw_size, u32 chunk_size, void* dst, size_t dst_capacity);
+
 #endif // SF_PROGRAM_H
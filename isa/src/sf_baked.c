@@ -0,0 +1,135 @@
+#include <sionflow/isa/sf_baked.h>
+#include <sionflow/isa/sf_fused.h>
+#include <sionflow/isa/sf_opcodes.h>
+#include <sionflow/base/sf_log.h>
+#include <string.h>
+
+// --- Operand Classification ---
+
+static const sf_bin_task_binding* find_binding(const sf_program* prog, const sf_task* task, u16 reg) {
+    for (u32 i = 0; i < task->binding_count; ++i) {
+        const sf_bin_task_binding* b = &prog->bindings[task->binding_offset + i];
+        if (b->reg_idx == reg) return b;
+    }
+    return NULL;
+}
+
+sf_stride_class sf_task_operand_class(const sf_program* prog, const sf_task* task, u16 reg, i32* out_inner_stride) {
+    if (out_inner_stride) *out_inner_stride = 0;
+
+    const sf_type_info* domain = &prog->tensor_infos[task->domain_reg];
+    const sf_type_info* info = &prog->tensor_infos[reg];
+    const sf_bin_task_binding* b = find_binding(prog, task, reg);
+    if (!b) {
+        // Unbound registers are only valid for scalars read as a single value
+        return info->ndim == 0 ? SF_STRIDE_BROADCAST : SF_STRIDE_STRIDED;
+    }
+
+    int ndim = domain->ndim;
+    if (ndim == 0) return SF_STRIDE_BROADCAST;
+    if (out_inner_stride) *out_inner_stride = b->strides[ndim - 1];
+
+    bool zero = true;
+    for (int d = 0; d < ndim; ++d) {
+        if (b->strides[d] != 0) zero = false;
+    }
+    if (zero) return SF_STRIDE_BROADCAST;
+
+    // Dense strides of the domain for this operand's element size
+    i32 expected = (i32)sf_dtype_size(info->dtype);
+    for (int d = ndim - 1; d >= 0; --d) {
+        if (b->strides[d] != expected) return SF_STRIDE_STRIDED;
+        if (d > 0 && domain->shape[d] <= 0) return SF_STRIDE_STRIDED; // Dynamic extent: cannot prove density
+        expected *= domain->shape[d];
+    }
+    return SF_STRIDE_CONTIGUOUS;
+}
+
+// --- Baker ---
+
+static u8 source_count(u16 opcode) {
+    const sf_op_metadata* meta = sf_get_op_metadata(opcode);
+    u8 count = 0;
+    if (meta) {
+        while (count < 4 && meta->ports[count]) count++;
+    }
+    return count;
+}
+
+size_t sf_bake_program_calc_size(const sf_program* prog) {
+    // Arena allocations are rounded up to 16 bytes (see sf_arena_alloc)
+    size_t total = (sizeof(sf_baked_task) * prog->meta.task_count + 15) & ~(size_t)15;
+    for (u32 t = 0; t < prog->meta.task_count; ++t) {
+        total += (sizeof(sf_baked_inst) * prog->tasks[t].inst_count + 15) & ~(size_t)15;
+    }
+    return total;
+}
+
+bool sf_bake_task(sf_baked_task* out, const sf_program* prog, const sf_task* task, const sf_baker_desc* desc, sf_arena* arena) {
+    if (!out || !prog || !task || !desc || !desc->resolve || !arena) return false;
+    if ((u64)task->start_inst + task->inst_count > prog->meta.instruction_count) {
+        SF_LOG_ERROR("Baker: task instruction range [%u + %u] is out of bounds", task->start_inst, task->inst_count);
+        return false;
+    }
+
+    memset(out, 0, sizeof(sf_baked_task));
+    out->task = task;
+    out->inst_count = task->inst_count;
+    out->reg_count = sf_task_register_count(prog, task);
+    out->flags = SF_BAKED_TASK_CONTIGUOUS;
+    out->insts = SF_ARENA_PUSH(arena, sf_baked_inst, task->inst_count);
+    if (!out->insts && task->inst_count > 0) return false;
+
+    for (u32 i = 0; i < task->inst_count; ++i) {
+        const sf_instruction* src = &prog->code[task->start_inst + i];
+        sf_baked_inst* inst = &out->insts[i];
+        memset(inst, 0, sizeof(sf_baked_inst));
+        inst->opcode = src->opcode;
+        inst->operand_count = (u8)(1 + source_count(src->opcode));
+
+        const u16 regs[SF_BAKED_MAX_OPERANDS] = { src->dest_idx, src->src1_idx, src->src2_idx, src->src3_idx, src->src4_idx };
+        for (u8 k = 0; k < inst->operand_count; ++k) {
+            if (regs[k] >= prog->meta.tensor_count) {
+                SF_LOG_ERROR("Baker: instruction %u uses register %u of %u", task->start_inst + i, regs[k], prog->meta.tensor_count);
+                return false;
+            }
+            sf_baked_operand* op = &inst->ops[k];
+            op->reg = regs[k];
+            op->dtype = (u8)prog->tensor_infos[regs[k]].dtype;
+            op->stride_class = (u8)sf_task_operand_class(prog, task, regs[k], &op->inner_stride);
+            if (op->stride_class == SF_STRIDE_STRIDED) out->flags &= ~SF_BAKED_TASK_CONTIGUOUS;
+        }
+
+        if (src->opcode == SF_OP_FUSED) {
+            if (!sf_fused_chain_validate(prog, src->src1_idx)) return false;
+            inst->aux = src->src1_idx;
+            const sf_bin_fused_chain* chain = &prog->fused_chains[src->src1_idx];
+            for (u32 k = 0; k < chain->input_count; ++k) {
+                if (sf_task_operand_class(prog, task, chain->inputs[k], NULL) == SF_STRIDE_STRIDED) out->flags &= ~SF_BAKED_TASK_CONTIGUOUS;
+            }
+        }
+
+        inst->fn = desc->resolve(desc->user_data, inst);
+        if (!inst->fn) {
+            SF_LOG_ERROR("Baker: no kernel for %s (instruction %u)", sf_opcode_to_str(src->opcode), task->start_inst + i);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sf_bake_program(sf_baked_program* out, const sf_program* prog, const sf_baker_desc* desc, sf_arena* arena) {
+    if (!out || !prog || !arena) return false;
+
+    memset(out, 0, sizeof(sf_baked_program));
+    out->program = prog;
+    out->task_count = prog->meta.task_count;
+    out->tasks = SF_ARENA_PUSH(arena, sf_baked_task, prog->meta.task_count);
+    if (!out->tasks && prog->meta.task_count > 0) return false;
+
+    for (u32 t = 0; t < prog->meta.task_count; ++t) {
+        if (!sf_bake_task(&out->tasks[t], prog, &prog->tasks[t], desc, arena)) return false;
+        if (out->tasks[t].reg_count > out->reg_count) out->reg_count = out->tasks[t].reg_count;
+    }
+    return true;
+}
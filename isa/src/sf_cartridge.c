@@ -0,0 +1,804 @@
+#include <sionflow/isa/sf_cartridge.h>
+#include <sionflow/base/sf_log.h>
+#include <sionflow/base/sf_lz.h>
+#include <sionflow/base/sf_crc32c.h>
+#include <sionflow/base/sf_simd_math.h>
+#include <sionflow/base/sf_utils.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Header ---
+
+static bool alloc_sections(sf_cartridge* cart, u32 count) {
+    cart->sections = calloc(count ? count : 1, sizeof(sf_section_header));
+    cart->section_state = calloc(count ? count : 1, sizeof(sf_atomic_i32));
+    if (!cart->sections || !cart->section_state) {
+        SF_LOG_ERROR("Cartridge: out of memory for %u section headers", count);
+        return false;
+    }
+    return true;
+}
+
+// v20 files carry a fixed table of 32-bit entries inside the header.
+static bool parse_header_v20(sf_cartridge* cart) {
+    if (cart->size < sizeof(sf_cartridge_header_v20)) {
+        SF_LOG_ERROR("Cartridge: file too small for v20 header (%zu bytes)", cart->size);
+        return false;
+    }
+
+    sf_cartridge_header_v20 legacy;
+    memcpy(&legacy, cart->data, sizeof(legacy));
+    if (legacy.section_count > SF_MAX_SECTIONS_V20) {
+        SF_LOG_ERROR("Cartridge: section count %u exceeds v20 limit %d", legacy.section_count, SF_MAX_SECTIONS_V20);
+        return false;
+    }
+
+    sf_cartridge_header* h = &cart->header;
+    memset(h, 0, sizeof(sf_cartridge_header));
+    h->magic = legacy.magic;
+    h->version = legacy.version;
+    memcpy(h->app_title, legacy.app_title, SF_MAX_TITLE_NAME);
+    h->window_width = legacy.window_width;
+    h->window_height = legacy.window_height;
+    h->num_threads = legacy.num_threads;
+    h->vsync = legacy.vsync;
+    h->fullscreen = legacy.fullscreen;
+    h->resizable = legacy.resizable;
+    h->section_count = legacy.section_count;
+
+    if (!alloc_sections(cart, legacy.section_count)) return false;
+    for (u32 i = 0; i < legacy.section_count; ++i) {
+        const sf_section_header_v20* src = &legacy.sections[i];
+        sf_section_header* dst = &cart->sections[i];
+        memcpy(dst->name, src->name, SF_MAX_SYMBOL_NAME);
+        dst->type = src->type;
+        dst->codec = src->codec;
+        dst->offset = src->offset;
+        dst->size = src->size;
+        dst->raw_size = src->codec != SF_SECTION_CODEC_NONE ? src->raw_size : src->size;
+        dst->chunk_size = src->chunk_size;
+        if (src->codec != SF_SECTION_CODEC_NONE) dst->flags = SF_SECTION_FLAG_CHUNK_TABLE_U32;
+    }
+    return true;
+}
+
+static bool parse_section_table(sf_cartridge* cart) {
+    const sf_cartridge_header* h = &cart->header;
+    u64 table_size = (u64)h->section_count * sizeof(sf_section_header);
+    if ((h->section_table_offset & 15) != 0 || h->section_table_offset < sizeof(sf_cartridge_header) ||
+        h->section_table_offset > cart->size || table_size > cart->size - h->section_table_offset) {
+        SF_LOG_ERROR("Cartridge: section table [%llu + %u entries] is out of bounds",
+            (unsigned long long)h->section_table_offset, h->section_count);
+        return false;
+    }
+
+    if (!alloc_sections(cart, h->section_count)) return false;
+    memcpy(cart->sections, cart->data + h->section_table_offset, (size_t)table_size);
+
+    // Cheap (headers only) and catches corrupt offsets before any section is touched
+    if (h->content_hash != 0 && sf_cartridge_calc_content_hash(h, cart->sections) != h->content_hash) {
+        SF_LOG_ERROR("Cartridge: header or section table is corrupt (content hash mismatch)");
+        return false;
+    }
+    return true;
+}
+
+static bool parse_header(sf_cartridge* cart) {
+    cart->const_pool_section = -1;
+    u32 magic_version[2];
+    if (cart->size < sizeof(magic_version)) {
+        SF_LOG_ERROR("Cartridge: file too small for header (%zu bytes)", cart->size);
+        return false;
+    }
+
+    memcpy(magic_version, cart->data, sizeof(magic_version));
+    if (magic_version[0] != SF_BINARY_MAGIC) {
+        SF_LOG_ERROR("Cartridge: bad magic 0x%08X", magic_version[0]);
+        return false;
+    }
+
+    if (magic_version[1] == SF_BINARY_VERSION_V20) {
+        if (!parse_header_v20(cart)) return false;
+    } else if (magic_version[1] >= SF_BINARY_VERSION_V21 && magic_version[1] <= SF_BINARY_VERSION) {
+        if (cart->size < sizeof(sf_cartridge_header)) {
+            SF_LOG_ERROR("Cartridge: file too small for header (%zu bytes)", cart->size);
+            return false;
+        }
+        memcpy(&cart->header, cart->data, sizeof(sf_cartridge_header));
+        if (cart->header.math_precision >= SF_MATH_PRECISION_COUNT) {
+            SF_LOG_ERROR("Cartridge: unknown math precision %u", cart->header.math_precision);
+            return false;
+        }
+        if (!parse_section_table(cart)) return false;
+    } else {
+        SF_LOG_ERROR("Cartridge: unsupported version %u (expected %u)", magic_version[1], SF_BINARY_VERSION);
+        return false;
+    }
+
+    for (u32 i = 0; i < cart->header.section_count; ++i) {
+        const sf_section_header* s = &cart->sections[i];
+        if (s->offset > cart->size || s->size > cart->size - s->offset) {
+            SF_LOG_ERROR("Cartridge: section '%.*s' [%llu + %llu] is out of bounds", SF_MAX_SYMBOL_NAME, s->name,
+                (unsigned long long)s->offset, (unsigned long long)s->size);
+            return false;
+        }
+        // Every later path trusts codec and chunk_size, so a bad pair fails here once
+        if (s->codec != SF_SECTION_CODEC_NONE && (s->codec != SF_SECTION_CODEC_LZ || s->chunk_size == 0)) {
+            SF_LOG_ERROR("Cartridge: section '%.*s' has unsupported codec %u (chunk size %u)", SF_MAX_SYMBOL_NAME, s->name,
+                s->codec, s->chunk_size);
+            return false;
+        }
+        sf_atomic_store(&cart->section_state[i], SF_SECTION_STATE_COLD);
+        if (s->type == SF_SECTION_CONST_POOL && cart->const_pool_section < 0) cart->const_pool_section = (i32)i;
+    }
+    return true;
+}
+
+// --- Open / Close ---
+
+bool sf_cartridge_open_file(sf_cartridge* cart, const char* path) {
+    if (!cart || !path) return false;
+    memset(cart, 0, sizeof(sf_cartridge));
+
+    // Random: sections are touched on demand, read-ahead would pull in neighbours
+    if (!sf_file_map_open(&cart->map, path, SF_FILE_MAP_ADVICE_RANDOM)) {
+        SF_LOG_ERROR("Cartridge: failed to map '%s'", path);
+        return false;
+    }
+    cart->owns_map = true;
+    cart->data = (const u8*)cart->map.data;
+    cart->size = cart->map.size;
+
+    if (!parse_header(cart)) {
+        sf_cartridge_close(cart);
+        return false;
+    }
+    return true;
+}
+
+bool sf_cartridge_open_memory(sf_cartridge* cart, const void* data, size_t size) {
+    if (!cart || !data) return false;
+    memset(cart, 0, sizeof(sf_cartridge));
+    cart->data = (const u8*)data;
+    cart->size = size;
+    if (!parse_header(cart)) {
+        sf_cartridge_close(cart);
+        return false;
+    }
+    return true;
+}
+
+void sf_cartridge_close(sf_cartridge* cart) {
+    if (!cart) return;
+    if (cart->owns_map) sf_file_map_close(&cart->map);
+    free(cart->sections);
+    free((void*)cart->section_state);
+    memset(cart, 0, sizeof(sf_cartridge));
+}
+
+// --- Sections ---
+
+i32 sf_cartridge_find_section(const sf_cartridge* cart, const char* name, u32 type) {
+    if (!cart || !name) return -1;
+    for (u32 i = 0; i < cart->header.section_count; ++i) {
+        const sf_section_header* s = &cart->sections[i];
+        if (type != 0 && s->type != type) continue;
+        if (strncmp(s->name, name, SF_MAX_SYMBOL_NAME) == 0) return (i32)i;
+    }
+    return -1;
+}
+
+const sf_section_header* sf_cartridge_get_section_header(const sf_cartridge* cart, u32 index) {
+    if (!cart || index >= cart->header.section_count) return NULL;
+    return &cart->sections[index];
+}
+
+const void* sf_cartridge_get_section(sf_cartridge* cart, u32 index, size_t* out_size) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s) return NULL;
+
+    sf_atomic_store(&cart->section_state[index], SF_SECTION_STATE_ACCESSED);
+    if (out_size) *out_size = (size_t)s->size;
+    return cart->data + s->offset;
+}
+
+void sf_cartridge_prefetch(sf_cartridge* cart, u32 index) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s) return;
+
+    if (sf_atomic_load(&cart->section_state[index]) == SF_SECTION_STATE_COLD) {
+        sf_atomic_store(&cart->section_state[index], SF_SECTION_STATE_PREFETCHED);
+    }
+    if (cart->owns_map) {
+        sf_file_map_advise(&cart->map, s->offset, s->size, SF_FILE_MAP_ADVICE_WILLNEED);
+    }
+}
+
+void sf_cartridge_evict(sf_cartridge* cart, u32 index) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s || !cart->owns_map) return;
+
+    // Pages are clean and file-backed, so dropping them only costs a re-read
+    sf_file_map_advise(&cart->map, s->offset, s->size, SF_FILE_MAP_ADVICE_DONTNEED);
+    sf_atomic_store(&cart->section_state[index], SF_SECTION_STATE_COLD);
+}
+
+sf_section_state sf_cartridge_get_section_state(sf_cartridge* cart, u32 index) {
+    if (!cart || index >= cart->header.section_count) return SF_SECTION_STATE_COLD;
+    return (sf_section_state)sf_atomic_load(&cart->section_state[index]);
+}
+
+size_t sf_cartridge_get_section_raw_size(const sf_cartridge* cart, u32 index) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s) return 0;
+    return (size_t)(s->codec != SF_SECTION_CODEC_NONE ? s->raw_size : s->size);
+}
+
+bool sf_cartridge_decompress_section(sf_cartridge* cart, u32 index, void* dst, size_t dst_size, sf_thread_pool* pool) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s || !dst) return false;
+
+    size_t stored = 0;
+    const void* payload = sf_cartridge_get_section(cart, index, &stored);
+    if (s->codec == SF_SECTION_CODEC_NONE) {
+        if (dst_size < stored) return false;
+        memcpy(dst, payload, stored);
+        return true;
+    }
+    return sf_section_decompress(s, payload, dst, dst_size, pool);
+}
+
+// Decompressed copies are 64-byte aligned so programs can still load in place.
+static void* push_raw_buffer(sf_arena* arena, size_t size) {
+    u8* mem = SF_ARENA_PUSH(arena, u8, size + SF_PROGRAM_LOAD_ALIGNMENT);
+    if (!mem) return NULL;
+    return (void*)(((uintptr_t)mem + SF_PROGRAM_LOAD_ALIGNMENT - 1) & ~(uintptr_t)(SF_PROGRAM_LOAD_ALIGNMENT - 1));
+}
+
+// Points desc at the cartridge's constant pool (inflating it if it was stored compressed).
+static bool bind_const_pool(sf_cartridge* cart, sf_program_load_desc* desc, sf_arena* arena) {
+    if (cart->const_pool_section < 0) return true;
+
+    u32 index = (u32)cart->const_pool_section;
+    const sf_section_header* s = &cart->sections[index];
+    size_t size = 0;
+    const void* data = sf_cartridge_get_section(cart, index, &size);
+    if (s->codec != SF_SECTION_CODEC_NONE) {
+        size = (size_t)s->raw_size;
+        void* raw = push_raw_buffer(arena, size);
+        if (!raw || !sf_section_decompress(s, data, raw, size, NULL)) return false;
+        data = raw;
+    }
+    desc->const_pool = data;
+    desc->const_pool_size = size;
+    return true;
+}
+
+// Raw bytes of a PROGRAM section, inflated into 'arena' if it is stored compressed.
+static const void* program_section_data(sf_cartridge* cart, u32 index, sf_arena* arena, size_t* out_size) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s) return NULL;
+    if (s->type != SF_SECTION_PROGRAM) {
+        SF_LOG_ERROR("Cartridge: section '%.*s' is not a program", SF_MAX_SYMBOL_NAME, s->name);
+        return NULL;
+    }
+
+    const void* data = sf_cartridge_get_section(cart, index, out_size);
+    if (data && s->codec != SF_SECTION_CODEC_NONE) {
+        *out_size = (size_t)s->raw_size;
+        void* raw = push_raw_buffer(arena, *out_size);
+        if (!raw || !sf_section_decompress(s, data, raw, *out_size, NULL)) return NULL;
+        data = raw;
+    }
+    return data;
+}
+
+bool sf_cartridge_load_program(sf_cartridge* cart, u32 index, sf_program* prog, sf_arena* arena, const sf_program_load_desc* desc) {
+    size_t size = 0;
+    const void* data = program_section_data(cart, index, arena, &size);
+    if (!data) return false;
+
+    sf_program_load_desc local = {0};
+    if (desc) local = *desc;
+    if (!local.binary_version) local.binary_version = cart->header.version;
+    if (!local.const_pool && !bind_const_pool(cart, &local, arena)) return false;
+    return sf_program_load_from_buffer_ex(prog, data, size, arena, &local);
+}
+
+bool sf_cartridge_load_debug_info(sf_cartridge* cart, u32 index, sf_program* prog, sf_arena* arena) {
+    size_t size = 0;
+    const void* data = program_section_data(cart, index, arena, &size);
+    if (!data || !prog) return false;
+
+    sf_program_load_desc local = {0};
+    local.binary_version = cart->header.version;
+    return sf_program_load_debug_info(prog, data, size, arena, &local);
+}
+
+// Older cartridges carry the pipeline as JSON text, exposed as a raw section.
+static bool has_binary_pipeline(const sf_cartridge* cart, const sf_section_header* s) {
+    return s->type == SF_SECTION_PIPELINE && cart->header.version >= SF_BINARY_PIPELINE_VERSION;
+}
+
+bool sf_cartridge_load_pipeline(sf_cartridge* cart, u32 index, sf_pipeline* pipe, sf_arena* arena) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s || !pipe) return false;
+    if (!has_binary_pipeline(cart, s)) {
+        SF_LOG_ERROR("Cartridge: section '%.*s' is not a binary pipeline", SF_MAX_SYMBOL_NAME, s->name);
+        return false;
+    }
+
+    size_t size = 0;
+    const void* data = sf_cartridge_get_section(cart, index, &size);
+    if (s->codec != SF_SECTION_CODEC_NONE) {
+        if (!arena) return false;
+        size = (size_t)s->raw_size;
+        void* raw = push_raw_buffer(arena, size);
+        if (!raw || !sf_section_decompress(s, data, raw, size, NULL)) return false;
+        data = raw;
+    }
+    return sf_pipeline_load_from_buffer(pipe, data, size);
+}
+
+// --- Integrity ---
+
+u64 sf_cartridge_calc_content_hash(const sf_cartridge_header* header, const sf_section_header* sections) {
+    sf_cartridge_header h = *header;
+    h.content_hash = 0;
+    u64 hash = sf_fnv1a_hash64_update(SF_FNV1A64_INIT, &h, sizeof(h));
+    return sf_fnv1a_hash64_update(hash, sections, sizeof(sf_section_header) * header->section_count);
+}
+
+u64 sf_cartridge_content_hash(const sf_cartridge* cart) {
+    return cart ? cart->header.content_hash : 0;
+}
+
+static bool has_checksum(const sf_section_header* s) {
+    return (s->flags & SF_SECTION_FLAG_CHECKSUM) != 0;
+}
+
+static bool check_section_crc(const sf_section_header* s, u32 crc) {
+    if (crc == s->checksum) return true;
+    SF_LOG_ERROR("Cartridge: section '%.*s' checksum mismatch (stored %08X, computed %08X)",
+        SF_MAX_SYMBOL_NAME, s->name, s->checksum, crc);
+    return false;
+}
+
+bool sf_cartridge_verify_section(sf_cartridge* cart, u32 index) {
+    const sf_section_header* s = sf_cartridge_get_section_header(cart, index);
+    if (!s) return false;
+    if (!has_checksum(s)) return true;
+    return check_section_crc(s, sf_crc32c(0, cart->data + s->offset, (size_t)s->size));
+}
+
+typedef struct {
+    const u8* data;
+    size_t size;
+    u32 section;
+    u32 crc;
+} verify_job;
+
+static void verify_job_entry(u32 job_idx, void* thread_local_data, void* user_data) {
+    (void)thread_local_data;
+    verify_job* job = &((verify_job*)user_data)[job_idx];
+    job->crc = sf_crc32c(0, job->data, job->size);
+}
+
+bool sf_cartridge_verify(sf_cartridge* cart, sf_thread_pool* pool) {
+    if (!cart) return false;
+
+    u32 job_count = 0;
+    for (u32 i = 0; i < cart->header.section_count; ++i) {
+        const sf_section_header* s = &cart->sections[i];
+        if (!has_checksum(s)) continue;
+        u64 blocks = (s->size + SF_CARTRIDGE_VERIFY_BLOCK - 1) / SF_CARTRIDGE_VERIFY_BLOCK;
+        job_count += blocks > 0 ? (u32)blocks : 1;
+    }
+    if (job_count == 0) return true;
+
+    verify_job* jobs = malloc(sizeof(verify_job) * job_count);
+    if (!jobs) return false;
+
+    // Sections are read front to back exactly once, so ask for read-ahead
+    u32 cursor = 0;
+    for (u32 i = 0; i < cart->header.section_count; ++i) {
+        const sf_section_header* s = &cart->sections[i];
+        if (!has_checksum(s)) continue;
+        if (cart->owns_map) sf_file_map_advise(&cart->map, s->offset, s->size, SF_FILE_MAP_ADVICE_WILLNEED);
+
+        u64 pos = 0;
+        do {
+            u64 len = s->size - pos;
+            if (len > SF_CARTRIDGE_VERIFY_BLOCK) len = SF_CARTRIDGE_VERIFY_BLOCK;
+            jobs[cursor++] = (verify_job){ cart->data + s->offset + pos, (size_t)len, i, 0 };
+            pos += len;
+        } while (pos < s->size);
+    }
+
+    if (pool && job_count > 1) {
+        sf_thread_pool_run(pool, job_count, verify_job_entry, jobs);
+    } else {
+        for (u32 j = 0; j < job_count; ++j) verify_job_entry(j, NULL, jobs);
+    }
+
+    // Blocks of a section are consecutive; fold them back into one CRC
+    bool ok = true;
+    for (u32 j = 0; j < job_count;) {
+        u32 section = jobs[j].section;
+        u32 crc = jobs[j].crc;
+        for (++j; j < job_count && jobs[j].section == section; ++j) {
+            crc = sf_crc32c_combine(crc, jobs[j].crc, jobs[j].size);
+        }
+        if (!check_section_crc(&cart->sections[section], crc)) ok = false;
+    }
+
+    free(jobs);
+    return ok;
+}
+
+// --- Constant Pool ---
+
+const void* sf_const_pool_get_blob(const void* pool, size_t pool_size, u32 index, u64* out_size) {
+    if (!pool || pool_size < sizeof(sf_const_pool_header)) return NULL;
+
+    const sf_const_pool_header* header = (const sf_const_pool_header*)pool;
+    if (index >= header->blob_count) return NULL;
+    if (sizeof(sf_const_pool_header) + sizeof(sf_const_pool_entry) * ((size_t)index + 1) > pool_size) return NULL;
+
+    const sf_const_pool_entry* entry = (const sf_const_pool_entry*)((const u8*)pool + sizeof(sf_const_pool_header)) + index;
+    if (entry->offset > pool_size || entry->size > pool_size - entry->offset) return NULL;
+
+    if (out_size) *out_size = entry->size;
+    return (const u8*)pool + entry->offset;
+}
+
+// --- Chunked Section Compression ---
+
+static u32 chunk_count_for(size_t raw_size, u32 chunk_size) {
+    return (u32)((raw_size + chunk_size - 1) / chunk_size);
+}
+
+size_t sf_section_compress_bound(size_t raw_size, u32 chunk_size) {
+    if (chunk_size == 0) return 0;
+    u32 chunks = chunk_count_for(raw_size, chunk_size);
+    // Stored chunks never exceed their raw size (incompressible ones are kept raw)
+    return sizeof(u64) * ((size_t)chunks + 1) + raw_size;
+}
+
+size_t sf_section_compress(const void* raw, size_t raw_size, u32 chunk_size, void* dst, size_t dst_capacity) {
+    if (chunk_size == 0 || dst_capacity < sf_section_compress_bound(raw_size, chunk_size)) return 0;
+
+    u32 chunks = chunk_count_for(raw_size, chunk_size);
+    u8* out = (u8*)dst;
+    u64* offsets = (u64*)dst;
+    size_t pos = sizeof(u64) * ((size_t)chunks + 1);
+
+    u8* scratch = malloc(sf_lz_compress_bound(chunk_size));
+    if (!scratch) return 0;
+
+    for (u32 c = 0; c < chunks; ++c) {
+        const u8* src = (const u8*)raw + (size_t)c * chunk_size;
+        size_t len = raw_size - (size_t)c * chunk_size;
+        if (len > chunk_size) len = chunk_size;
+
+        size_t packed = sf_lz_compress(src, len, scratch, sf_lz_compress_bound(chunk_size));
+        offsets[c] = pos;
+        if (packed > 0 && packed < len) {
+            memcpy(out + pos, scratch, packed);
+            pos += packed;
+        } else {
+            memcpy(out + pos, src, len);
+            pos += len;
+        }
+    }
+    offsets[chunks] = pos;
+
+    free(scratch);
+    return pos;
+}
+
+typedef struct {
+    const u8* payload;
+    u64 offsets_begin;   // Stored range of the chunk
+    u64 offsets_end;
+    u8* dst;             // Destination of the chunk inside the section buffer
+    size_t dst_size;
+} chunk_job;
+
+static bool decode_chunk(const chunk_job* job) {
+    size_t stored = (size_t)(job->offsets_end - job->offsets_begin);
+    const u8* src = job->payload + job->offsets_begin;
+    if (stored == job->dst_size) {
+        memcpy(job->dst, src, stored);
+        return true;
+    }
+    return sf_lz_decompress(src, stored, job->dst, job->dst_size);
+}
+
+// v20 sections use 32-bit chunk offsets, everything newer 64-bit.
+static u64 chunk_offset(const sf_section_header* header, const void* payload, u32 index) {
+    if (header->flags & SF_SECTION_FLAG_CHUNK_TABLE_U32) return ((const u32*)payload)[index];
+    return ((const u64*)payload)[index];
+}
+
+// Builds the chunk jobs of one section after validating its chunk table.
+static bool plan_chunks(const sf_section_header* header, const void* payload, u8* dst, size_t dst_size, chunk_job* out_jobs) {
+    if (header->codec != SF_SECTION_CODEC_LZ || header->chunk_size == 0) {
+        SF_LOG_ERROR("Cartridge: section '%.*s' has unsupported codec %u", SF_MAX_SYMBOL_NAME, header->name, header->codec);
+        return false;
+    }
+    if (dst_size < header->raw_size) return false;
+
+    u32 chunks = chunk_count_for(header->raw_size, header->chunk_size);
+    size_t entry_size = (header->flags & SF_SECTION_FLAG_CHUNK_TABLE_U32) ? sizeof(u32) : sizeof(u64);
+    size_t table_size = entry_size * ((size_t)chunks + 1);
+    if (header->size < table_size) return false;
+
+    if (chunk_offset(header, payload, 0) != table_size || chunk_offset(header, payload, chunks) > header->size) {
+        SF_LOG_ERROR("Cartridge: section '%.*s' has a corrupt chunk table", SF_MAX_SYMBOL_NAME, header->name);
+        return false;
+    }
+
+    for (u32 c = 0; c < chunks; ++c) {
+        u64 stored_begin = chunk_offset(header, payload, c);
+        u64 stored_end = chunk_offset(header, payload, c + 1);
+        if (stored_end < stored_begin) return false;
+        size_t begin = (size_t)c * header->chunk_size;
+        size_t len = (size_t)header->raw_size - begin;
+        if (len > header->chunk_size) len = header->chunk_size;
+
+        out_jobs[c].payload = (const u8*)payload;
+        out_jobs[c].offsets_begin = stored_begin;
+        out_jobs[c].offsets_end = stored_end;
+        out_jobs[c].dst = dst + begin;
+        out_jobs[c].dst_size = len;
+    }
+    return true;
+}
+
+typedef struct {
+    const chunk_job* jobs;
+    sf_atomic_i32 failed;
+} chunk_batch_ctx;
+
+static void chunk_job_entry(u32 job_idx, void* thread_local_data, void* user_data) {
+    (void)thread_local_data;
+    chunk_batch_ctx* ctx = (chunk_batch_ctx*)user_data;
+    if (!decode_chunk(&ctx->jobs[job_idx])) sf_atomic_store(&ctx->failed, 1);
+}
+
+static bool run_chunk_jobs(const chunk_job* jobs, u32 count, sf_thread_pool* pool) {
+    chunk_batch_ctx ctx = { jobs, 0 };
+    if (pool && count > 1) {
+        sf_thread_pool_run(pool, count, chunk_job_entry, &ctx);
+    } else {
+        for (u32 i = 0; i < count; ++i) chunk_job_entry(i, NULL, &ctx);
+    }
+    return sf_atomic_load(&ctx.failed) == 0;
+}
+
+bool sf_section_decompress(const sf_section_header* header, const void* payload, void* dst, size_t dst_size, sf_thread_pool* pool) {
+    if (!header || !payload || !dst || header->chunk_size == 0) return false;
+
+    u32 chunks = chunk_count_for(header->raw_size, header->chunk_size);
+    chunk_job* jobs = malloc(sizeof(chunk_job) * (chunks ? chunks : 1));
+    if (!jobs) return false;
+
+    bool ok = plan_chunks(header, payload, (u8*)dst, dst_size, jobs) && run_chunk_jobs(jobs, chunks, pool);
+    if (!ok) SF_LOG_ERROR("Cartridge: failed to decompress section '%.*s'", SF_MAX_SYMBOL_NAME, header->name);
+
+    free(jobs);
+    return ok;
+}
+
+// --- Parallel Loading ---
+
+typedef struct {
+    sf_cartridge* cart;
+    const sf_cartridge_load_desc* desc;
+    sf_program_load_desc program_desc;   // desc->program_desc with the constant pool bound
+    // Per section (header.section_count entries each)
+    const sf_section_decoder** decoders;
+    const void** data;                   // Raw (decompressed) section bytes
+    size_t* data_size;
+    sf_arena* arenas;
+    sf_section_load_result* results;
+} load_job_ctx;
+
+static const sf_section_decoder* find_decoder(const sf_cartridge_load_desc* desc, u32 type) {
+    for (u32 i = 0; i < desc->decoder_count; ++i) {
+        if (desc->decoders[i].type == type) return &desc->decoders[i];
+    }
+    return NULL;
+}
+
+static void load_section_job(u32 job_idx, void* thread_local_data, void* user_data) {
+    (void)thread_local_data;
+    load_job_ctx* ctx = (load_job_ctx*)user_data;
+    sf_section_load_result* res = &ctx->results[job_idx];
+    if (!res->decoded) return;
+
+    const sf_section_header* header = &ctx->cart->sections[job_idx];
+    const void* data = ctx->data[job_idx];
+    size_t size = ctx->data_size[job_idx];
+    sf_arena* arena = &ctx->arenas[job_idx];
+
+    u64 t0 = sf_time_now_ns();
+    const sf_section_decoder* dec = ctx->decoders[job_idx];
+    if (header->type == SF_SECTION_PROGRAM) {
+        sf_program* prog = (sf_program*)res->result;
+        res->ok = sf_program_load_from_buffer_ex(prog, data, size, arena, &ctx->program_desc);
+    } else if (dec) {
+        res->ok = dec->decode(header, data, size, arena, &res->result, dec->user_data);
+    } else {
+        res->ok = sf_pipeline_load_from_buffer((sf_pipeline*)res->result, data, size);
+    }
+    res->decode_ns = sf_time_now_ns() - t0;
+    res->arena_used += arena->pos;
+
+    if (!res->ok) {
+        SF_LOG_ERROR("Cartridge: failed to decode section '%.*s'", SF_MAX_SYMBOL_NAME, header->name);
+    }
+}
+
+// Inflates every compressed section as one flat batch of chunk jobs.
+static bool decompress_sections(load_job_ctx* ctx, sf_arena* arena) {
+    sf_cartridge* cart = ctx->cart;
+    u32 total_chunks = 0;
+    for (u32 i = 0; i < cart->header.section_count; ++i) {
+        const sf_section_header* h = &cart->sections[i];
+        // parse_header guarantees chunk_size > 0 for compressed sections
+        if (h->codec != SF_SECTION_CODEC_NONE) total_chunks += chunk_count_for(h->raw_size, h->chunk_size);
+    }
+    if (total_chunks == 0) return true;
+
+    chunk_job* jobs = malloc(sizeof(chunk_job) * total_chunks);
+    if (!jobs) return false;
+
+    bool ok = true;
+    u32 cursor = 0;
+    for (u32 i = 0; i < cart->header.section_count && ok; ++i) {
+        const sf_section_header* h = &cart->sections[i];
+        if (h->codec == SF_SECTION_CODEC_NONE) continue;
+
+        u8* raw = push_raw_buffer(arena, h->raw_size);
+        ok = raw && plan_chunks(h, ctx->data[i], raw, h->raw_size, jobs + cursor);
+        ctx->results[i].arena_used = (size_t)h->raw_size + SF_PROGRAM_LOAD_ALIGNMENT;
+        ctx->data[i] = raw;
+        ctx->data_size[i] = h->raw_size;
+        cursor += chunk_count_for(h->raw_size, h->chunk_size);
+    }
+
+    if (ok) {
+        u64 t0 = sf_time_now_ns();
+        ok = run_chunk_jobs(jobs, total_chunks, ctx->desc->pool);
+        u64 elapsed = sf_time_now_ns() - t0;
+        // Attribute the batch time to sections by their share of decoded bytes
+        u64 total_raw = 0;
+        for (u32 i = 0; i < cart->header.section_count; ++i) {
+            if (cart->sections[i].codec != SF_SECTION_CODEC_NONE) total_raw += cart->sections[i].raw_size;
+        }
+        for (u32 i = 0; i < cart->header.section_count && total_raw > 0; ++i) {
+            const sf_section_header* h = &cart->sections[i];
+            if (h->codec != SF_SECTION_CODEC_NONE) {
+                ctx->results[i].decompress_ns = (u64)((double)elapsed * (double)h->raw_size / (double)total_raw);
+            }
+        }
+    }
+    if (!ok) SF_LOG_ERROR("Cartridge: failed to decompress sections");
+
+    free(jobs);
+    return ok;
+}
+
+static bool load_sections(load_job_ctx* ctx, sf_arena* arena) {
+    sf_cartridge* cart = ctx->cart;
+    const sf_cartridge_load_desc* desc = ctx->desc;
+    sf_section_load_result* out_results = ctx->results;
+    u32 count = cart->header.section_count;
+
+    if (desc->verify && !sf_cartridge_verify(cart, desc->pool)) return false;
+
+    for (u32 i = 0; i < count; ++i) {
+        ctx->data[i] = sf_cartridge_get_section(cart, i, &ctx->data_size[i]);
+    }
+
+    // 1. Inflate compressed sections (chunk-parallel, straight into their final buffers)
+    if (!decompress_sections(ctx, arena)) return false;
+
+    ctx->program_desc = desc->program_desc;
+    if (!ctx->program_desc.binary_version) ctx->program_desc.binary_version = cart->header.version;
+    if (!ctx->program_desc.const_pool && cart->const_pool_section >= 0) {
+        ctx->program_desc.const_pool = ctx->data[cart->const_pool_section];
+        ctx->program_desc.const_pool_size = ctx->data_size[cart->const_pool_section];
+    }
+
+    // 2. Plan: size and carve a private sub-arena per section (serial, headers only)
+    for (u32 i = 0; i < count; ++i) {
+        const sf_section_header* header = &cart->sections[i];
+        const void* data = ctx->data[i];
+        size_t data_size = ctx->data_size[i];
+        sf_section_load_result* res = &out_results[i];
+        size_t need = 0;
+
+        if (header->type == SF_SECTION_PROGRAM) {
+            if (data_size < sizeof(sf_bin_header)) {
+                SF_LOG_ERROR("Cartridge: program section '%.*s' is truncated", SF_MAX_SYMBOL_NAME, header->name);
+                return false;
+            }
+            need = sf_program_calc_load_size(data, data_size, &ctx->program_desc);
+            res->result = SF_ARENA_PUSH(arena, sf_program, 1);
+            if (!res->result) return false;
+            memset(res->result, 0, sizeof(sf_program));
+        } else {
+            ctx->decoders[i] = find_decoder(desc, header->type);
+            if (!ctx->decoders[i] && has_binary_pipeline(cart, header)) {
+                // Built-in: the pipeline tables alias the section bytes, no sub-arena needed
+                res->result = SF_ARENA_PUSH(arena, sf_pipeline, 1);
+                if (!res->result) return false;
+                res->decoded = true;
+                continue;
+            }
+            if (!ctx->decoders[i]) {
+                // No decoder: expose the (lazily mapped or inflated) payload as-is
+                res->result = (void*)data;
+                res->ok = true;
+                continue;
+            }
+            if (ctx->decoders[i]->calc_size) {
+                need = ctx->decoders[i]->calc_size(header, data, data_size, ctx->decoders[i]->user_data);
+                need = (need + 15) & ~(size_t)15;
+            }
+        }
+
+        void* mem = NULL;
+        if (need > 0) {
+            mem = sf_arena_alloc((sf_allocator*)arena, need);
+            if (!mem) return false;
+        }
+        sf_arena_init(&ctx->arenas[i], mem, need);
+        res->decoded = true;
+    }
+
+    // 3. Decode independent sections concurrently
+    if (desc->pool) {
+        sf_thread_pool_run(desc->pool, count, load_section_job, ctx);
+    } else {
+        for (u32 i = 0; i < count; ++i) load_section_job(i, NULL, ctx);
+    }
+
+    bool ok = true;
+    for (u32 i = 0; i < count; ++i) {
+        if (!out_results[i].ok) ok = false;
+        if (!out_results[i].decoded) continue;
+        SF_LOG_DEBUG("Cartridge: section '%.*s' decoded in %.3f ms (%zu bytes)", SF_MAX_SYMBOL_NAME,
+            cart->sections[i].name, (double)out_results[i].decode_ns / 1e6, out_results[i].arena_used);
+    }
+    return ok;
+}
+
+bool sf_cartridge_load_all(sf_cartridge* cart, const sf_cartridge_load_desc* desc, sf_arena* arena, sf_section_load_result* out_results) {
+    if (!cart || !desc || !arena || !out_results) return false;
+
+    u32 count = cart->header.section_count;
+    load_job_ctx ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.cart = cart;
+    ctx.desc = desc;
+    ctx.results = out_results;
+    memset(out_results, 0, sizeof(sf_section_load_result) * count);
+
+    size_t n = count ? count : 1;
+    ctx.decoders = calloc(n, sizeof(*ctx.decoders));
+    ctx.data = calloc(n, sizeof(*ctx.data));
+    ctx.data_size = calloc(n, sizeof(*ctx.data_size));
+    ctx.arenas = calloc(n, sizeof(*ctx.arenas));
+
+    bool ok = ctx.decoders && ctx.data && ctx.data_size && ctx.arenas && load_sections(&ctx, arena);
+
+    free(ctx.decoders);
+    free(ctx.data);
+    free(ctx.data_size);
+    free(ctx.arenas);
+    return ok;
+}
@@ -1,4 +1,6 @@
 #include <sionflow/isa/sf_exec_ctx.h>
+#include <sionflow/isa/sf_opcodes.h>
+#include <sionflow/base/sf_log.h>
 #include <string.h>
 
 void sf_exec_ctx_init(sf_exec_ctx* ctx, sf_allocator* allocator) {
@@ -11,6 +13,72 @@ void sf_exec_ctx_init(sf_exec_ctx* ctx, sf_allocator* allocator) {
     ctx->global_error_ptr = NULL;
 }
 
+// --- Register Tables ---
+// One block, widest elements first: ptrs | strides | shapes | ndims | dtypes
+
+size_t sf_exec_ctx_calc_registers_size(u32 reg_count) {
+    return (size_t)reg_count * (sizeof(void*) + 2 * sizeof(int32_t) * SF_MAX_DIMS + 2 * sizeof(uint8_t));
+}
+
+void sf_exec_ctx_bind_registers(sf_exec_ctx* ctx, void* memory, u32 reg_count) {
+    u8* ptr = (u8*)memory;
+    memset(ptr, 0, sf_exec_ctx_calc_registers_size(reg_count));
+
+    ctx->reg_count = reg_count;
+    ctx->reg_ptrs = (void**)ptr;
+    ptr += sizeof(void*) * reg_count;
+    ctx->reg_strides = (int32_t (*)[SF_MAX_DIMS])ptr;
+    ptr += sizeof(int32_t) * SF_MAX_DIMS * reg_count;
+    ctx->reg_shapes = (int32_t (*)[SF_MAX_DIMS])ptr;
+    ptr += sizeof(int32_t) * SF_MAX_DIMS * reg_count;
+    ctx->reg_ndims = ptr;
+    ptr += reg_count;
+    ctx->reg_dtypes = ptr;
+}
+
+bool sf_exec_ctx_alloc_registers(sf_exec_ctx* ctx, u32 reg_count) {
+    if (!ctx || !ctx->allocator) return false;
+    void* mem = ctx->allocator->alloc(ctx->allocator, sf_exec_ctx_calc_registers_size(reg_count));
+    if (!mem) {
+        SF_LOG_ERROR("Exec Context: out of memory for %u registers", reg_count);
+        return false;
+    }
+    sf_exec_ctx_bind_registers(ctx, mem, reg_count);
+    return true;
+}
+
+static void count_register(u32* count, u32 reg) {
+    if (reg + 1 > *count) *count = reg + 1;
+}
+
+u32 sf_task_register_count(const sf_program* prog, const sf_task* task) {
+    u32 count = 0;
+    count_register(&count, task->domain_reg);
+    for (u32 i = 0; i < task->binding_count; ++i) {
+        count_register(&count, prog->bindings[task->binding_offset + i].reg_idx);
+    }
+
+    // Operands may also be unbound registers (scalars read as a single value)
+    u64 end = (u64)task->start_inst + task->inst_count;
+    if (end > prog->meta.instruction_count) end = prog->meta.instruction_count;
+    for (u32 i = task->start_inst; i < end; ++i) {
+        const sf_instruction* inst = &prog->code[i];
+        count_register(&count, inst->dest_idx);
+        if (inst->opcode == SF_OP_FUSED) {
+            // src1 is a chain index; the chain lists the registers it reads
+            if (inst->src1_idx >= prog->meta.fused_chain_count) continue;
+            const sf_bin_fused_chain* chain = &prog->fused_chains[inst->src1_idx];
+            u32 inputs = chain->input_count < SF_FUSED_MAX_INPUTS ? chain->input_count : SF_FUSED_MAX_INPUTS;
+            for (u32 k = 0; k < inputs; ++k) count_register(&count, chain->inputs[k]);
+            continue;
+        }
+        const sf_op_metadata* meta = sf_get_op_metadata(inst->opcode);
+        const u16 srcs[4] = { inst->src1_idx, inst->src2_idx, inst->src3_idx, inst->src4_idx };
+        for (u32 k = 0; meta && k < 4 && meta->ports[k]; ++k) count_register(&count, srcs[k]);
+    }
+    return count;
+}
+
 void* sf_exec_ctx_scratch_alloc(sf_exec_ctx* ctx, size_t size) {
     if (!ctx || !ctx->allocator) return NULL;
     return ctx->allocator->alloc(ctx->allocator, size);
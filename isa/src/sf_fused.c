@@ -0,0 +1,171 @@
+#include <sionflow/isa/sf_fused.h>
+#include <sionflow/isa/sf_opcodes.h>
+#include <sionflow/base/sf_log.h>
+#include <math.h>
+#include <string.h>
+
+// --- Micro-ops ---
+
+u8 sf_fused_op_arity(u16 opcode) {
+    switch (opcode) {
+        case SF_OP_ABS: case SF_OP_SIN: case SF_OP_COS: case SF_OP_SQRT:
+        case SF_OP_FLOOR: case SF_OP_CEIL: case SF_OP_NOT:
+            return 1;
+        case SF_OP_ADD: case SF_OP_SUB: case SF_OP_MUL: case SF_OP_DIV:
+        case SF_OP_POW: case SF_OP_ATAN2: case SF_OP_MIN: case SF_OP_MAX: case SF_OP_STEP:
+        case SF_OP_LESS: case SF_OP_GREATER: case SF_OP_EQUAL: case SF_OP_NEQUAL:
+        case SF_OP_LEQUAL: case SF_OP_GEQUAL: case SF_OP_AND: case SF_OP_OR: case SF_OP_XOR:
+            return 2;
+        case SF_OP_FMA: case SF_OP_CLAMP: case SF_OP_MIX: case SF_OP_SMOOTHSTEP: case SF_OP_SELECT:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+// --- Validation ---
+
+bool sf_fused_chain_validate(const sf_program* prog, u32 chain_idx) {
+    if (!prog || chain_idx >= prog->meta.fused_chain_count) {
+        SF_LOG_ERROR("Fused: chain %u of %u", chain_idx, prog ? prog->meta.fused_chain_count : 0);
+        return false;
+    }
+    const sf_bin_fused_chain* chain = &prog->fused_chains[chain_idx];
+    if (chain->op_count == 0 || (u64)chain->op_offset + chain->op_count > prog->meta.fused_op_count) {
+        SF_LOG_ERROR("Fused: chain %u micro-op range [%u + %u] is out of bounds", chain_idx, chain->op_offset, chain->op_count);
+        return false;
+    }
+    if (chain->vreg_count > SF_FUSED_MAX_VREGS || chain->input_count > SF_FUSED_MAX_INPUTS ||
+        chain->input_count > chain->vreg_count || chain->result >= chain->vreg_count) {
+        SF_LOG_ERROR("Fused: chain %u has a bad register file (%u inputs, %u vregs, result v%u)",
+                     chain_idx, chain->input_count, chain->vreg_count, chain->result);
+        return false;
+    }
+    for (u32 k = 0; k < chain->input_count; ++k) {
+        if (chain->inputs[k] >= prog->meta.tensor_count) {
+            SF_LOG_ERROR("Fused: chain %u input %u uses register %u of %u", chain_idx, k, chain->inputs[k], prog->meta.tensor_count);
+            return false;
+        }
+    }
+
+    u32 defined = (1u << chain->input_count) - 1;
+    for (u32 i = 0; i < chain->op_count; ++i) {
+        const sf_bin_fused_op* op = &prog->fused_ops[chain->op_offset + i];
+        u8 arity = sf_fused_op_arity(op->opcode);
+        if (arity == 0) {
+            SF_LOG_ERROR("Fused: chain %u op %u: %s is not an elementwise micro-op", chain_idx, i, sf_opcode_to_str(op->opcode));
+            return false;
+        }
+        for (u8 k = 0; k < arity; ++k) {
+            if (op->src[k] >= chain->vreg_count || !(defined & (1u << op->src[k]))) {
+                SF_LOG_ERROR("Fused: chain %u op %u reads undefined v%u", chain_idx, i, op->src[k]);
+                return false;
+            }
+        }
+        if (op->dest >= chain->vreg_count) {
+            SF_LOG_ERROR("Fused: chain %u op %u writes v%u of %u", chain_idx, i, op->dest, chain->vreg_count);
+            return false;
+        }
+        defined |= 1u << op->dest;
+    }
+    if (!(defined & (1u << chain->result))) {
+        SF_LOG_ERROR("Fused: chain %u never writes its result v%u", chain_idx, chain->result);
+        return false;
+    }
+    return true;
+}
+
+bool sf_program_validate_fused(const sf_program* prog) {
+    if (!prog) return false;
+    for (u32 c = 0; c < prog->meta.fused_chain_count; ++c) {
+        if (!sf_fused_chain_validate(prog, c)) return false;
+    }
+    for (u32 i = 0; i < prog->meta.instruction_count; ++i) {
+        const sf_instruction* inst = &prog->code[i];
+        if (inst->opcode == SF_OP_FUSED && inst->src1_idx >= prog->meta.fused_chain_count) {
+            SF_LOG_ERROR("Fused: instruction %u references chain %u of %u", i, inst->src1_idx, prog->meta.fused_chain_count);
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- Reference Evaluator ---
+
+static inline f32 truth(bool b) { return b ? 1.0f : 0.0f; }
+
+static void eval_op(u16 opcode, f32* d, const f32* a, const f32* b, const f32* c, size_t n, sf_math_precision precision) {
+    switch (opcode) {
+        case SF_OP_ADD:     for (size_t i = 0; i < n; ++i) d[i] = a[i] + b[i]; break;
+        case SF_OP_SUB:     for (size_t i = 0; i < n; ++i) d[i] = a[i] - b[i]; break;
+        case SF_OP_MUL:     for (size_t i = 0; i < n; ++i) d[i] = a[i] * b[i]; break;
+        case SF_OP_DIV:     for (size_t i = 0; i < n; ++i) d[i] = a[i] / b[i]; break;
+        case SF_OP_MIN:     for (size_t i = 0; i < n; ++i) d[i] = a[i] < b[i] ? a[i] : b[i]; break;
+        case SF_OP_MAX:     for (size_t i = 0; i < n; ++i) d[i] = a[i] > b[i] ? a[i] : b[i]; break;
+        case SF_OP_POW:     sf_simd_pow(a, b, d, n, precision); break;
+        case SF_OP_ATAN2:   sf_simd_atan2(a, b, d, n, precision); break;
+        case SF_OP_STEP:    for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] <= b[i]); break;
+        case SF_OP_ABS:     for (size_t i = 0; i < n; ++i) d[i] = fabsf(a[i]); break;
+        case SF_OP_SIN:     sf_simd_sin(a, d, n, precision); break;
+        case SF_OP_COS:     sf_simd_cos(a, d, n, precision); break;
+        case SF_OP_SQRT:    sf_simd_sqrt(a, d, n, precision); break;
+        case SF_OP_FLOOR:   for (size_t i = 0; i < n; ++i) d[i] = floorf(a[i]); break;
+        case SF_OP_CEIL:    for (size_t i = 0; i < n; ++i) d[i] = ceilf(a[i]); break;
+        case SF_OP_LESS:    for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] < b[i]); break;
+        case SF_OP_GREATER: for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] > b[i]); break;
+        case SF_OP_EQUAL:   for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] == b[i]); break;
+        case SF_OP_NEQUAL:  for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] != b[i]); break;
+        case SF_OP_LEQUAL:  for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] <= b[i]); break;
+        case SF_OP_GEQUAL:  for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] >= b[i]); break;
+        case SF_OP_AND:     for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] != 0.0f && b[i] != 0.0f); break;
+        case SF_OP_OR:      for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] != 0.0f || b[i] != 0.0f); break;
+        case SF_OP_XOR:     for (size_t i = 0; i < n; ++i) d[i] = truth((a[i] != 0.0f) != (b[i] != 0.0f)); break;
+        case SF_OP_NOT:     for (size_t i = 0; i < n; ++i) d[i] = truth(a[i] == 0.0f); break;
+        case SF_OP_FMA:     for (size_t i = 0; i < n; ++i) d[i] = a[i] * b[i] + c[i]; break;
+        case SF_OP_CLAMP:
+            for (size_t i = 0; i < n; ++i) {
+                f32 v = a[i] > b[i] ? a[i] : b[i];
+                d[i] = v < c[i] ? v : c[i];
+            }
+            break;
+        case SF_OP_MIX:     for (size_t i = 0; i < n; ++i) d[i] = a[i] + (b[i] - a[i]) * c[i]; break;
+        case SF_OP_SMOOTHSTEP:
+            for (size_t i = 0; i < n; ++i) {
+                f32 t = (c[i] - a[i]) / (b[i] - a[i]);
+                t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+                d[i] = t * t * (3.0f - 2.0f * t);
+            }
+            break;
+        case SF_OP_SELECT:  for (size_t i = 0; i < n; ++i) d[i] = a[i] != 0.0f ? b[i] : c[i]; break;
+        default: break; // Rejected by validation
+    }
+}
+
+bool sf_fused_eval_f32(const sf_program* prog, const sf_bin_fused_chain* chain, const f32* const* inputs, u32 broadcast_mask, f32* out, size_t count, sf_math_precision precision) {
+    if (!prog || !chain || !out) return false;
+
+    f32 vregs[SF_FUSED_MAX_VREGS][SF_FUSED_EVAL_BLOCK];
+    const sf_bin_fused_op* ops = &prog->fused_ops[chain->op_offset];
+
+    for (size_t base = 0; base < count; base += SF_FUSED_EVAL_BLOCK) {
+        size_t n = count - base < SF_FUSED_EVAL_BLOCK ? count - base : SF_FUSED_EVAL_BLOCK;
+
+        for (u32 k = 0; k < chain->input_count; ++k) {
+            if (broadcast_mask & (1u << k)) {
+                for (size_t i = 0; i < n; ++i) vregs[k][i] = inputs[k][0];
+            } else {
+                memcpy(vregs[k], inputs[k] + base, n * sizeof(f32));
+            }
+        }
+        for (u32 i = 0; i < chain->op_count; ++i) {
+            const sf_bin_fused_op* op = &ops[i];
+            // Sources past the arity are unchecked and may hold any value
+            const u8 arity = sf_fused_op_arity(op->opcode);
+            const f32* src[3] = { NULL, NULL, NULL };
+            for (u8 k = 0; k < arity; ++k) src[k] = vregs[op->src[k]];
+            eval_op(op->opcode, vregs[op->dest], src[0], src[1], src[2], n, precision);
+        }
+        memcpy(out + base, vregs[chain->result], n * sizeof(f32));
+    }
+    return true;
+}
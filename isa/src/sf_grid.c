@@ -0,0 +1,184 @@
+#include <sionflow/isa/sf_grid.h>
+#include <sionflow/base/sf_log.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Curve Keys ---
+
+// Spreads the low 'bits' bits of v so that consecutive bits land 'stride' apart.
+static u64 spread_bits(u32 v, int bits, int stride, int shift) {
+    u64 res = 0;
+    for (int b = 0; b < bits; ++b) {
+        res |= (u64)((v >> b) & 1u) << (b * stride + shift);
+    }
+    return res;
+}
+
+static u64 morton_key(const u32* coord, u8 ndim) {
+    int bits = 64 / ndim;
+    if (bits > 32) bits = 32;
+    u64 key = 0;
+    // Innermost dimension gets the lowest bit so that the curve matches
+    // row-major order for a single row of tiles.
+    for (int d = 0; d < ndim; ++d) {
+        key |= spread_bits(coord[d], bits, ndim, ndim - 1 - d);
+    }
+    return key;
+}
+
+// Classic Hilbert xy -> d mapping for an n x n square (n is a power of two).
+static u64 hilbert_key_2d(u32 n, u32 x, u32 y) {
+    u64 d = 0;
+    for (u32 s = n / 2; s > 0; s /= 2) {
+        u32 rx = (x & s) > 0;
+        u32 ry = (y & s) > 0;
+        d += (u64)s * s * ((3 * rx) ^ ry);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = s - 1 - x;
+                y = s - 1 - y;
+            }
+            u32 t = x; x = y; y = t;
+        }
+    }
+    return d;
+}
+
+typedef struct {
+    u64 key;
+    u32 tile_idx;
+} tile_key;
+
+static int tile_key_cmp(const void* a, const void* b) {
+    const tile_key* ka = (const tile_key*)a;
+    const tile_key* kb = (const tile_key*)b;
+    if (ka->key != kb->key) return ka->key < kb->key ? -1 : 1;
+    if (ka->tile_idx != kb->tile_idx) return ka->tile_idx < kb->tile_idx ? -1 : 1;
+    return 0;
+}
+
+static void decode_coord(const sf_grid* grid, u8 ndim, u32 tile_idx, u32* out_coord) {
+    for (int d = (int)ndim - 1; d >= 0; --d) {
+        u32 dim = grid->dims[d] > 0 ? grid->dims[d] : 1;
+        out_coord[d] = tile_idx % dim;
+        tile_idx /= dim;
+    }
+}
+
+// --- Plan ---
+
+bool sf_grid_plan_init(sf_grid_plan* plan, const sf_grid* grid, u8 ndim, const u32* domain_shape, sf_grid_order order, sf_arena* arena) {
+    if (!plan || !grid || ndim > SF_MAX_DIMS) return false;
+    if ((u32)order >= SF_GRID_ORDER_COUNT) {
+        SF_LOG_ERROR("Grid Plan: unknown traversal order %u", (u32)order);
+        return false;
+    }
+
+    memset(plan, 0, sizeof(sf_grid_plan));
+    plan->grid = *grid;
+    plan->ndim = ndim;
+    plan->order = order;
+
+    u32 expected = 1;
+    for (int d = 0; d < ndim; ++d) {
+        expected *= grid->dims[d];
+        plan->domain_shape[d] = domain_shape ? domain_shape[d] : grid->dims[d] * grid->tile_shape[d];
+    }
+    if (grid->total_tiles != expected) {
+        SF_LOG_ERROR("Grid Plan: total_tiles (%u) does not match product of dims (%u)", grid->total_tiles, expected);
+        return false;
+    }
+
+    // Curves only change anything with at least two dimensions
+    if (order == SF_GRID_ORDER_ROW_MAJOR || ndim < 2 || grid->total_tiles <= 1) {
+        plan->order = SF_GRID_ORDER_ROW_MAJOR;
+        return true;
+    }
+
+    u32 total = grid->total_tiles;
+    tile_key* keys = malloc(sizeof(tile_key) * total);
+    if (!keys) return false;
+
+    // Side of the enclosing power-of-two square for the Hilbert curve
+    u32 side = 1;
+    u32 max_dim = grid->dims[ndim - 1] > grid->dims[ndim - 2] ? grid->dims[ndim - 1] : grid->dims[ndim - 2];
+    while (side < max_dim) side <<= 1;
+
+    u32 coord[SF_MAX_DIMS];
+    for (u32 t = 0; t < total; ++t) {
+        decode_coord(grid, ndim, t, coord);
+        keys[t].tile_idx = t;
+        if (order == SF_GRID_ORDER_MORTON) {
+            keys[t].key = morton_key(coord, ndim);
+        } else { // SF_GRID_ORDER_HILBERT
+            // Outer dimensions stay row-major, the spatial plane follows the curve
+            u64 outer = 0;
+            for (int d = 0; d < ndim - 2; ++d) outer = outer * grid->dims[d] + coord[d];
+            keys[t].key = outer * (u64)side * side + hilbert_key_2d(side, coord[ndim - 1], coord[ndim - 2]);
+        }
+    }
+
+    qsort(keys, total, sizeof(tile_key), tile_key_cmp);
+
+    plan->tile_order = SF_ARENA_PUSH(arena, u32, total);
+    if (!plan->tile_order) {
+        free(keys);
+        return false;
+    }
+    for (u32 t = 0; t < total; ++t) plan->tile_order[t] = keys[t].tile_idx;
+
+    free(keys);
+    return true;
+}
+
+void sf_grid_get_tile(const sf_grid_plan* plan, u32 job_idx, sf_grid_tile* out_tile) {
+    u32 tile_idx = plan->tile_order ? plan->tile_order[job_idx] : job_idx;
+
+    out_tile->job_idx = job_idx;
+    out_tile->tile_idx = tile_idx;
+    out_tile->ndim = plan->ndim;
+    out_tile->elem_count = 1;
+
+    decode_coord(&plan->grid, plan->ndim, tile_idx, out_tile->tile_coord);
+
+    for (int d = 0; d < plan->ndim; ++d) {
+        u32 start = out_tile->tile_coord[d] * plan->grid.tile_shape[d];
+        u32 size = plan->grid.tile_shape[d];
+        if (start + size > plan->domain_shape[d]) {
+            size = start < plan->domain_shape[d] ? plan->domain_shape[d] - start : 0;
+        }
+        out_tile->tile_offset[d] = start;
+        out_tile->tile_size[d] = size;
+        out_tile->elem_count *= size;
+    }
+}
+
+// --- Dispatch ---
+
+typedef struct {
+    const sf_grid_plan* plan;
+    sf_grid_job_func job_fn;
+    void* user_data;
+} grid_job_ctx;
+
+static void grid_job_entry(u32 job_idx, void* thread_local_data, void* user_data) {
+    grid_job_ctx* ctx = (grid_job_ctx*)user_data;
+    sf_grid_tile tile;
+    sf_grid_get_tile(ctx->plan, job_idx, &tile);
+    ctx->job_fn(&tile, thread_local_data, ctx->user_data);
+}
+
+void sf_grid_run(sf_thread_pool* pool, const sf_grid_plan* plan, sf_grid_job_func job_fn, void* user_data) {
+    if (!plan || !job_fn || plan->grid.total_tiles == 0) return;
+
+    grid_job_ctx ctx = { plan, job_fn, user_data };
+
+    if (!pool) {
+        for (u32 i = 0; i < plan->grid.total_tiles; ++i) {
+            grid_job_entry(i, NULL, &ctx);
+        }
+        return;
+    }
+
+    sf_thread_pool_run(pool, plan->grid.total_tiles, grid_job_entry, &ctx);
+}
@@ -0,0 +1,618 @@
+#include <sionflow/isa/sf_jit.h>
+#include <sionflow/isa/sf_baked.h>
+#include <sionflow/isa/sf_opcodes.h>
+#include <sionflow/base/sf_log.h>
+#include <sionflow/base/sf_utils.h>
+#include <sionflow/base/sf_platform.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define SF_JIT_X64 1
+#endif
+
+// --- Chain Analysis ---
+// Architecture independent: which registers are loaded, kept in registers or stored.
+
+typedef struct {
+    u16 opcode;
+    u8 src_count;
+    u16 dest;
+    u16 src[4];
+} chain_inst;
+
+typedef struct {
+    u32 inst_count;
+    chain_inst* insts;
+
+    // Per register [tensor_count]
+    i32* last_read;     // Last instruction reading it, -1 if never read
+    i32* last_write;    // Last instruction writing it, -1 if never written
+    i32* slot;          // Operand slot, -1 if it never touches memory
+    u8* is_input;       // Read before the chain writes it
+    u8* is_output;      // Written and bound for writing: stored after its last write
+    u8* stride_class;   // sf_stride_class
+
+    u32 slot_count;
+    u16 slot_regs[SF_JIT_MAX_SLOTS];
+
+    // Cache key: canonical description of everything the generated code depends on
+    u32* sig;
+    u32 sig_len;
+} jit_chain;
+
+static bool op_supported(u16 opcode) {
+    switch (opcode) {
+        case SF_OP_ADD: case SF_OP_SUB: case SF_OP_MUL: case SF_OP_DIV:
+        case SF_OP_MIN: case SF_OP_MAX: case SF_OP_ABS: case SF_OP_SQRT:
+        case SF_OP_FMA: case SF_OP_CLAMP: case SF_OP_MIX: case SF_OP_STEP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static u16 binding_flags(const sf_program* prog, const sf_task* task, u16 reg) {
+    for (u32 i = 0; i < task->binding_count; ++i) {
+        const sf_bin_task_binding* b = &prog->bindings[task->binding_offset + i];
+        if (b->reg_idx == reg) return b->flags;
+    }
+    return 0;
+}
+
+static void chain_free(jit_chain* c) {
+    free(c->insts);
+    free(c->last_read);
+    free(c->last_write);
+    free(c->slot);
+    free(c->is_input);
+    free(c->is_output);
+    free(c->stride_class);
+    free(c->sig);
+    memset(c, 0, sizeof(jit_chain));
+}
+
+static bool chain_build(jit_chain* c, const sf_program* prog, const sf_task* task) {
+    memset(c, 0, sizeof(jit_chain));
+    u32 regs = prog->meta.tensor_count;
+    if (task->inst_count == 0 || (u64)task->start_inst + task->inst_count > prog->meta.instruction_count) return false;
+
+    c->inst_count = task->inst_count;
+    c->insts = calloc(task->inst_count, sizeof(chain_inst));
+    c->last_read = malloc(sizeof(i32) * regs);
+    c->last_write = malloc(sizeof(i32) * regs);
+    c->slot = malloc(sizeof(i32) * regs);
+    c->is_input = calloc(regs, 1);
+    c->is_output = calloc(regs, 1);
+    c->stride_class = calloc(regs, 1);
+    if (!c->insts || !c->last_read || !c->last_write || !c->slot || !c->is_input || !c->is_output || !c->stride_class) return false;
+    for (u32 r = 0; r < regs; ++r) {
+        c->last_read[r] = -1;
+        c->last_write[r] = -1;
+        c->slot[r] = -1;
+    }
+
+    for (u32 i = 0; i < task->inst_count; ++i) {
+        const sf_instruction* src = &prog->code[task->start_inst + i];
+        if (!op_supported(src->opcode)) return false;
+
+        const sf_op_metadata* meta = sf_get_op_metadata(src->opcode);
+        chain_inst* ci = &c->insts[i];
+        ci->opcode = src->opcode;
+        ci->dest = src->dest_idx;
+        const u16 operands[4] = { src->src1_idx, src->src2_idx, src->src3_idx, src->src4_idx };
+        while (ci->src_count < 4 && meta->ports[ci->src_count]) {
+            ci->src[ci->src_count] = operands[ci->src_count];
+            ci->src_count++;
+        }
+
+        // Reads happen before the write of the same instruction
+        for (u8 k = 0; k < ci->src_count; ++k) {
+            u16 r = ci->src[k];
+            if (r >= regs || prog->tensor_infos[r].dtype != SF_DTYPE_F32) return false;
+            if (c->last_write[r] < 0) c->is_input[r] = 1;
+            c->last_read[r] = (i32)i;
+        }
+        if (ci->dest >= regs || prog->tensor_infos[ci->dest].dtype != SF_DTYPE_F32) return false;
+        c->last_write[ci->dest] = (i32)i;
+    }
+
+    // Assign memory slots and validate how each is walked
+    for (u32 i = 0; i < task->inst_count; ++i) {
+        const chain_inst* ci = &c->insts[i];
+        for (u8 k = 0; k <= ci->src_count; ++k) {
+            u16 r = k < ci->src_count ? ci->src[k] : ci->dest;
+            if (c->slot[r] >= 0) continue;
+            bool out = c->last_write[r] >= 0 && (binding_flags(prog, task, r) & SF_BINDING_FLAG_WRITE);
+            if (!c->is_input[r] && !out) continue;
+
+            sf_stride_class cls = sf_task_operand_class(prog, task, r, NULL);
+            if (cls == SF_STRIDE_STRIDED) return false;
+            if (out && cls != SF_STRIDE_CONTIGUOUS) return false;
+            if (c->slot_count == SF_JIT_MAX_SLOTS) return false;
+
+            c->is_output[r] = out;
+            c->stride_class[r] = (u8)cls;
+            c->slot[r] = (i32)c->slot_count;
+            c->slot_regs[c->slot_count++] = r;
+        }
+    }
+
+    // Signature: instructions, then per slot its register, class and direction
+    c->sig = malloc(sizeof(u32) * (task->inst_count * 6 + c->slot_count * 4 + 1));
+    if (!c->sig) return false;
+    for (u32 i = 0; i < task->inst_count; ++i) {
+        const chain_inst* ci = &c->insts[i];
+        c->sig[c->sig_len++] = ci->opcode | ((u32)ci->src_count << 16);
+        c->sig[c->sig_len++] = ci->dest;
+        for (u8 k = 0; k < 4; ++k) c->sig[c->sig_len++] = k < ci->src_count ? ci->src[k] : 0xFFFFu;
+    }
+    for (u32 s = 0; s < c->slot_count; ++s) {
+        u16 r = c->slot_regs[s];
+        c->sig[c->sig_len++] = r;
+        c->sig[c->sig_len++] = c->stride_class[r];
+        c->sig[c->sig_len++] = c->is_input[r];
+        c->sig[c->sig_len++] = c->is_output[r];
+    }
+    c->sig[c->sig_len++] = 0x4A495431u; // Codegen revision
+    return true;
+}
+
+// --- x86-64 Code Generation ---
+
+#if defined(SF_JIT_X64)
+
+// GPRs
+#define RAX 0
+#define RCX 1
+#define RDX 2
+#define RSI 6
+#define RDI 7
+#define R8  8
+#define R9  9
+#define R10 10
+#define R11 11
+
+// Register roles: r10 = operand table, r11 = count, rax = element index, r8 = operand base, r9 = scratch
+#if defined(_WIN32)
+    #define ARG0 RCX
+    #define ARG1 RDX
+    #define XMM_ALLOWED 0x003Fu // xmm6-15 are callee-saved on Win64
+#else
+    #define ARG0 RDI
+    #define ARG1 RSI
+    #define XMM_ALLOWED 0xFFFFu
+#endif
+
+// SSE opcodes (second byte after 0F)
+#define SSE_MOVU_LOAD  0x10
+#define SSE_MOVU_STORE 0x11
+#define SSE_MOVAPS     0x28
+#define SSE_SQRT       0x51
+#define SSE_ANDPS      0x54
+#define SSE_ADD        0x58
+#define SSE_MUL        0x59
+#define SSE_SUB        0x5C
+#define SSE_MIN        0x5D
+#define SSE_DIV        0x5E
+#define SSE_MAX        0x5F
+#define SSE_CMP        0xC2
+#define SSE_SHUFPS     0xC6
+
+#define CMP_LE 2
+
+typedef struct {
+    u8* code;
+    size_t size;
+    size_t capacity;
+    bool overflow;
+} emitter;
+
+static void emit_u8(emitter* e, u8 v) {
+    if (e->size == e->capacity) {
+        e->overflow = true;
+        return;
+    }
+    e->code[e->size++] = v;
+}
+
+static void emit_u32(emitter* e, u32 v) {
+    for (int i = 0; i < 4; ++i) emit_u8(e, (u8)(v >> (i * 8)));
+}
+
+static void patch_rel32(emitter* e, size_t at, size_t target) {
+    if (e->overflow) return;
+    u32 rel = (u32)((i64)target - (i64)(at + 4));
+    memcpy(e->code + at, &rel, 4);
+}
+
+static void emit_rex(emitter* e, bool w, int reg, int index, int base) {
+    u8 rex = (u8)(0x40 | (w ? 8 : 0) | ((reg & 8) ? 4 : 0) | ((index & 8) ? 2 : 0) | ((base & 8) ? 1 : 0));
+    if (rex != 0x40) emit_u8(e, rex);
+}
+
+// op xmm, xmm
+static void sse_rr(emitter* e, u8 prefix, u8 opc, int dst, int src) {
+    if (prefix) emit_u8(e, prefix);
+    emit_rex(e, false, dst, 0, src);
+    emit_u8(e, 0x0F);
+    emit_u8(e, opc);
+    emit_u8(e, (u8)(0xC0 | ((dst & 7) << 3) | (src & 7)));
+}
+
+// op xmm, [r8 + rax*4] (or [r8] when scalar_base)
+static void sse_mem(emitter* e, u8 prefix, u8 opc, int xmm, bool scalar_base) {
+    if (prefix) emit_u8(e, prefix);
+    emit_rex(e, false, xmm, scalar_base ? 0 : RAX, R8);
+    emit_u8(e, 0x0F);
+    emit_u8(e, opc);
+    if (scalar_base) {
+        emit_u8(e, (u8)(((xmm & 7) << 3) | (R8 & 7)));
+    } else {
+        emit_u8(e, (u8)(0x04 | ((xmm & 7) << 3)));
+        emit_u8(e, (u8)(0x80 | ((RAX & 7) << 3) | (R8 & 7)));
+    }
+}
+
+// mov r8, [r10 + slot * 8]
+static void emit_load_base(emitter* e, u32 slot) {
+    emit_rex(e, true, R8, 0, R10);
+    emit_u8(e, 0x8B);
+    emit_u8(e, (u8)(0x80 | ((R8 & 7) << 3) | (R10 & 7)));
+    emit_u32(e, slot * 8);
+}
+
+// mov dst, src (64-bit)
+static void emit_mov_rr(emitter* e, int dst, int src) {
+    emit_rex(e, true, src, 0, dst);
+    emit_u8(e, 0x89);
+    emit_u8(e, (u8)(0xC0 | ((src & 7) << 3) | (dst & 7)));
+}
+
+// cmp a, b (64-bit)
+static void emit_cmp_rr(emitter* e, int a, int b) {
+    emit_rex(e, true, b, 0, a);
+    emit_u8(e, 0x39);
+    emit_u8(e, (u8)(0xC0 | ((b & 7) << 3) | (a & 7)));
+}
+
+// pcmpeqd x, x / psrld x, imm / pslld x, imm
+static void emit_all_ones(emitter* e, int x) {
+    emit_u8(e, 0x66);
+    sse_rr(e, 0, 0x76, x, x);
+}
+
+static void emit_shift_imm(emitter* e, int x, int ext, u8 imm) {
+    emit_u8(e, 0x66);
+    emit_rex(e, false, 0, 0, x);
+    emit_u8(e, 0x0F);
+    emit_u8(e, 0x72);
+    emit_u8(e, (u8)(0xC0 | (ext << 3) | (x & 7)));
+    emit_u8(e, imm);
+}
+
+typedef struct {
+    emitter* e;
+    const jit_chain* c;
+    bool vec;           // Packed (4 lanes) or scalar tail
+    i8* xmm_of;         // Per register: vector register holding its current value, -1 if none
+    u32 free_mask;
+} body_state;
+
+static int xmm_alloc(body_state* b) {
+    for (int x = 0; x < 16; ++x) {
+        if (b->free_mask & (1u << x)) {
+            b->free_mask &= ~(1u << x);
+            return x;
+        }
+    }
+    return -1;
+}
+
+static void xmm_release(body_state* b, u16 reg) {
+    if (b->xmm_of[reg] < 0) return;
+    b->free_mask |= 1u << b->xmm_of[reg];
+    b->xmm_of[reg] = -1;
+}
+
+static int operand(body_state* b, u16 reg) {
+    if (b->xmm_of[reg] >= 0) return b->xmm_of[reg];
+
+    // Not produced by the chain yet, so it is an input
+    int x = xmm_alloc(b);
+    if (x < 0) return -1;
+    emit_load_base(b->e, (u32)b->c->slot[reg]);
+    if (b->c->stride_class[reg] == SF_STRIDE_BROADCAST) {
+        sse_mem(b->e, 0xF3, SSE_MOVU_LOAD, x, true);
+        if (b->vec) {
+            sse_rr(b->e, 0, SSE_SHUFPS, x, x);
+            emit_u8(b->e, 0);
+        }
+    } else {
+        sse_mem(b->e, b->vec ? 0 : 0xF3, SSE_MOVU_LOAD, x, false);
+    }
+    b->xmm_of[reg] = (i8)x;
+    return x;
+}
+
+static bool emit_inst(body_state* b, u32 i) {
+    const chain_inst* ci = &b->c->insts[i];
+    emitter* e = b->e;
+    u8 ps = b->vec ? 0 : 0xF3; // Packed or scalar form of arithmetic
+
+    int s[4];
+    for (u8 k = 0; k < ci->src_count; ++k) {
+        s[k] = operand(b, ci->src[k]);
+        if (s[k] < 0) return false;
+    }
+    int t = xmm_alloc(b);
+    if (t < 0) return false;
+
+    switch (ci->opcode) {
+        case SF_OP_ADD: case SF_OP_SUB: case SF_OP_MUL: case SF_OP_DIV: case SF_OP_MIN: case SF_OP_MAX: {
+            u8 opc = ci->opcode == SF_OP_ADD ? SSE_ADD : ci->opcode == SF_OP_SUB ? SSE_SUB :
+                     ci->opcode == SF_OP_MUL ? SSE_MUL : ci->opcode == SF_OP_DIV ? SSE_DIV :
+                     ci->opcode == SF_OP_MIN ? SSE_MIN : SSE_MAX;
+            sse_rr(e, 0, SSE_MOVAPS, t, s[0]);
+            sse_rr(e, ps, opc, t, s[1]);
+            break;
+        }
+        case SF_OP_ABS:
+            emit_all_ones(e, t);
+            emit_shift_imm(e, t, 2, 1); // psrld: 0x7FFFFFFF
+            sse_rr(e, 0, SSE_ANDPS, t, s[0]);
+            break;
+        case SF_OP_SQRT:
+            sse_rr(e, ps, SSE_SQRT, t, s[0]);
+            break;
+        case SF_OP_FMA: // a * b + c (two roundings)
+            sse_rr(e, 0, SSE_MOVAPS, t, s[0]);
+            sse_rr(e, ps, SSE_MUL, t, s[1]);
+            sse_rr(e, ps, SSE_ADD, t, s[2]);
+            break;
+        case SF_OP_CLAMP: // min(max(x, lo), hi)
+            sse_rr(e, 0, SSE_MOVAPS, t, s[0]);
+            sse_rr(e, ps, SSE_MAX, t, s[1]);
+            sse_rr(e, ps, SSE_MIN, t, s[2]);
+            break;
+        case SF_OP_MIX: // a + (b - a) * t
+            sse_rr(e, 0, SSE_MOVAPS, t, s[1]);
+            sse_rr(e, ps, SSE_SUB, t, s[0]);
+            sse_rr(e, ps, SSE_MUL, t, s[2]);
+            sse_rr(e, ps, SSE_ADD, t, s[0]);
+            break;
+        case SF_OP_STEP: { // edge <= x ? 1.0 : 0.0
+            int one = xmm_alloc(b);
+            if (one < 0) return false;
+            sse_rr(e, 0, SSE_MOVAPS, t, s[0]);
+            sse_rr(e, ps, SSE_CMP, t, s[1]);
+            emit_u8(e, CMP_LE);
+            emit_all_ones(e, one);
+            emit_shift_imm(e, one, 6, 25); // pslld: 0xFE000000
+            emit_shift_imm(e, one, 2, 2);  // psrld: 0x3F800000 (1.0f)
+            sse_rr(e, 0, SSE_ANDPS, t, one);
+            b->free_mask |= 1u << one;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    for (u8 k = 0; k < ci->src_count; ++k) {
+        if (b->c->last_read[ci->src[k]] == (i32)i) xmm_release(b, ci->src[k]);
+    }
+    xmm_release(b, ci->dest); // Previous value
+    b->xmm_of[ci->dest] = (i8)t;
+
+    if (b->c->is_output[ci->dest] && b->c->last_write[ci->dest] == (i32)i) {
+        emit_load_base(e, (u32)b->c->slot[ci->dest]);
+        sse_mem(e, b->vec ? 0 : 0xF3, SSE_MOVU_STORE, t, false);
+    }
+    if (b->c->last_read[ci->dest] <= (i32)i) xmm_release(b, ci->dest);
+    return true;
+}
+
+static bool emit_body(emitter* e, const jit_chain* c, i8* xmm_of, u32 reg_count, bool vec) {
+    body_state b = { e, c, vec, xmm_of, XMM_ALLOWED };
+    memset(xmm_of, -1, reg_count);
+    for (u32 i = 0; i < c->inst_count; ++i) {
+        if (!emit_inst(&b, i)) return false;
+    }
+    return true;
+}
+
+static bool emit_kernel(emitter* e, const jit_chain* c, u32 reg_count) {
+    i8* xmm_of = malloc(reg_count ? reg_count : 1);
+    if (!xmm_of) return false;
+
+    emit_mov_rr(e, R10, ARG0);
+    emit_mov_rr(e, R11, ARG1);
+    emit_u8(e, 0x31); emit_u8(e, 0xC0);                           // xor eax, eax
+
+    // Packed loop: while (rax + 4 <= count)
+    size_t vec_loop = e->size;
+    emit_u8(e, 0x4C); emit_u8(e, 0x8D); emit_u8(e, 0x48); emit_u8(e, 0x04); // lea r9, [rax + 4]
+    emit_cmp_rr(e, R9, R11);
+    emit_u8(e, 0x0F); emit_u8(e, 0x87);                           // ja tail
+    size_t to_tail = e->size;
+    emit_u32(e, 0);
+    bool ok = emit_body(e, c, xmm_of, reg_count, true);
+    emit_u8(e, 0x48); emit_u8(e, 0x83); emit_u8(e, 0xC0); emit_u8(e, 0x04); // add rax, 4
+    emit_u8(e, 0xE9);                                             // jmp vec_loop
+    size_t to_vec = e->size;
+    emit_u32(e, 0);
+    patch_rel32(e, to_vec, vec_loop);
+
+    // Scalar tail: while (rax < count)
+    size_t tail = e->size;
+    patch_rel32(e, to_tail, tail);
+    emit_cmp_rr(e, RAX, R11);
+    emit_u8(e, 0x0F); emit_u8(e, 0x83);                           // jae done
+    size_t to_done = e->size;
+    emit_u32(e, 0);
+    ok = ok && emit_body(e, c, xmm_of, reg_count, false);
+    emit_u8(e, 0x48); emit_u8(e, 0xFF); emit_u8(e, 0xC0);         // inc rax
+    emit_u8(e, 0xE9);                                             // jmp tail
+    size_t to_tail2 = e->size;
+    emit_u32(e, 0);
+    patch_rel32(e, to_tail2, tail);
+
+    patch_rel32(e, to_done, e->size);
+    emit_u8(e, 0xC3);                                             // ret
+
+    free(xmm_of);
+    return ok && !e->overflow;
+}
+
+#endif // SF_JIT_X64
+
+// --- Code Cache ---
+
+typedef struct {
+    u64 hash;
+    u32* sig;
+    u32 sig_len;
+    void* code;          // sf_exec_mem pages
+    sf_jit_kernel kernel;
+} jit_entry;
+
+struct sf_jit_cache {
+    sf_mutex_t lock;
+    jit_entry** slots;   // Open addressing by hash, NULL = empty
+    u32 capacity;        // Power of two
+    u32 count;
+};
+
+bool sf_jit_available(void) {
+#if defined(SF_JIT_X64)
+    return sf_cpu_has(SF_CPU_SSE2); // Always true on x86-64 unless masked off
+#else
+    return false;
+#endif
+}
+
+sf_jit_cache* sf_jit_cache_create(void) {
+    sf_jit_cache* cache = calloc(1, sizeof(sf_jit_cache));
+    if (!cache) return NULL;
+    cache->capacity = 64;
+    cache->slots = calloc(cache->capacity, sizeof(jit_entry*));
+    if (!cache->slots) {
+        free(cache);
+        return NULL;
+    }
+    sf_mutex_init(&cache->lock);
+    return cache;
+}
+
+void sf_jit_cache_destroy(sf_jit_cache* cache) {
+    if (!cache) return;
+    for (u32 i = 0; i < cache->capacity; ++i) {
+        jit_entry* entry = cache->slots[i];
+        if (!entry) continue;
+        sf_exec_mem_free(entry->code, entry->kernel.code_size);
+        free(entry->sig);
+        free(entry);
+    }
+    free(cache->slots);
+    sf_mutex_destroy(&cache->lock);
+    free(cache);
+}
+
+static jit_entry** cache_find(sf_jit_cache* cache, u64 hash, const u32* sig, u32 sig_len) {
+    u32 mask = cache->capacity - 1;
+    for (u32 i = (u32)hash & mask;; i = (i + 1) & mask) {
+        jit_entry* entry = cache->slots[i];
+        if (!entry) return &cache->slots[i];
+        if (entry->hash == hash && entry->sig_len == sig_len && memcmp(entry->sig, sig, sizeof(u32) * sig_len) == 0) {
+            return &cache->slots[i];
+        }
+    }
+}
+
+static bool cache_grow(sf_jit_cache* cache) {
+    u32 old_capacity = cache->capacity;
+    jit_entry** old = cache->slots;
+    cache->slots = calloc((size_t)old_capacity * 2, sizeof(jit_entry*));
+    if (!cache->slots) {
+        cache->slots = old;
+        return false;
+    }
+    cache->capacity = old_capacity * 2;
+    for (u32 i = 0; i < old_capacity; ++i) {
+        if (old[i]) *cache_find(cache, old[i]->hash, old[i]->sig, old[i]->sig_len) = old[i];
+    }
+    free(old);
+    return true;
+}
+
+static jit_entry* compile_entry(const jit_chain* chain, u32 reg_count) {
+#if defined(SF_JIT_X64)
+    emitter e = {0};
+    e.capacity = 64 + (size_t)chain->inst_count * 2 * 160;
+    e.code = malloc(e.capacity);
+    if (!e.code) return NULL;
+    if (!emit_kernel(&e, chain, reg_count)) {
+        free(e.code);
+        return NULL;
+    }
+
+    jit_entry* entry = calloc(1, sizeof(jit_entry));
+    void* code = sf_exec_mem_alloc(e.size);
+    if (!entry || !code) {
+        free(entry);
+        sf_exec_mem_free(code, e.size);
+        free(e.code);
+        return NULL;
+    }
+    memcpy(code, e.code, e.size);
+    free(e.code);
+    if (!sf_exec_mem_seal(code, e.size)) {
+        SF_LOG_ERROR("JIT: cannot make generated code executable");
+        sf_exec_mem_free(code, e.size);
+        free(entry);
+        return NULL;
+    }
+
+    entry->code = code;
+    entry->kernel.fn = (sf_jit_func)code;
+    entry->kernel.code_size = e.size;
+    entry->kernel.slot_count = chain->slot_count;
+    memcpy(entry->kernel.slot_regs, chain->slot_regs, sizeof(u16) * chain->slot_count);
+    return entry;
+#else
+    (void)chain; (void)reg_count;
+    return NULL;
+#endif
+}
+
+const sf_jit_kernel* sf_jit_compile_task(sf_jit_cache* cache, const sf_program* prog, const sf_task* task) {
+    if (!cache || !prog || !task || !sf_jit_available()) return NULL;
+
+    jit_chain chain;
+    if (!chain_build(&chain, prog, task)) {
+        chain_free(&chain);
+        return NULL;
+    }
+    u64 hash = sf_fnv1a_hash64(chain.sig, sizeof(u32) * chain.sig_len);
+
+    sf_mutex_lock(&cache->lock);
+    jit_entry** slot = cache_find(cache, hash, chain.sig, chain.sig_len);
+    jit_entry* entry = *slot;
+    if (!entry) {
+        entry = compile_entry(&chain, prog->meta.tensor_count);
+        if (entry) {
+            entry->hash = hash;
+            entry->kernel.hash = hash;
+            entry->sig = chain.sig;
+            entry->sig_len = chain.sig_len;
+            chain.sig = NULL; // Owned by the entry now
+            *slot = entry;
+            cache->count++;
+            if (cache->count * 2 > cache->capacity) cache_grow(cache);
+        }
+    }
+    sf_mutex_unlock(&cache->lock);
+
+    chain_free(&chain);
+    return entry ? &entry->kernel : NULL;
+}
@@ -0,0 +1,278 @@
+#include <sionflow/isa/sf_pipeline.h>
+#include <sionflow/base/sf_log.h>
+#include <sionflow/base/sf_shape.h>
+#include <ctype.h>
+#include <string.h>
+
+// --- Lookup ---
+
+i32 sf_pipeline_find_resource(const sf_pipeline* pipe, const char* name) {
+    if (!pipe || !name) return -1;
+    for (u32 i = 0; i < pipe->meta.resource_count; ++i) {
+        if (strcmp(sf_pipeline_string(pipe, pipe->resources[i].name), name) == 0) return (i32)i;
+    }
+    return -1;
+}
+
+// --- Validation ---
+
+static bool string_ok(const sf_pipeline* pipe, u32 offset) {
+    return offset < pipe->meta.string_size;
+}
+
+bool sf_pipeline_validate(const sf_pipeline* pipe) {
+    const sf_bin_pipeline_header* m = &pipe->meta;
+
+    // The last byte must terminate the final string, so every offset reads a bounded string
+    if (m->string_size > 0 && pipe->strings[m->string_size - 1] != '\0') {
+        SF_LOG_ERROR("Pipeline: string table is not NUL-terminated");
+        return false;
+    }
+
+    for (u32 i = 0; i < m->resource_count; ++i) {
+        const sf_bin_pipeline_resource* r = &pipe->resources[i];
+        if (!string_ok(pipe, r->name) || r->dtype >= SF_DTYPE_COUNT || r->ndim > SF_MAX_DIMS) {
+            SF_LOG_ERROR("Pipeline: resource %u is malformed", i);
+            return false;
+        }
+        if (r->data_offset > m->data_size || r->data_size > m->data_size - r->data_offset) {
+            SF_LOG_ERROR("Pipeline: data of resource '%s' is out of bounds", sf_pipeline_string(pipe, r->name));
+            return false;
+        }
+    }
+
+    for (u32 i = 0; i < m->kernel_count; ++i) {
+        const sf_bin_pipeline_kernel* k = &pipe->kernels[i];
+        if (!string_ok(pipe, k->id) || !string_ok(pipe, k->entry) ||
+            (u64)k->binding_offset + k->binding_count > m->binding_count) {
+            SF_LOG_ERROR("Pipeline: kernel %u is malformed", i);
+            return false;
+        }
+    }
+
+    for (u32 i = 0; i < m->binding_count; ++i) {
+        const sf_bin_pipeline_binding* b = &pipe->bindings[i];
+        if (!string_ok(pipe, b->port) || b->resource >= m->resource_count) {
+            SF_LOG_ERROR("Pipeline: binding %u is malformed", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- JSON Conversion ---
+
+typedef struct {
+    char* strings;
+    u32 string_size;
+} string_builder;
+
+// Appends a string once; repeated names (ports usually match resources) share an entry.
+static u32 intern_string(string_builder* sb, const char* s) {
+    u32 pos = 0;
+    while (pos < sb->string_size) {
+        if (strcmp(sb->strings + pos, s) == 0) return pos;
+        pos += (u32)strlen(sb->strings + pos) + 1;
+    }
+    size_t len = strlen(s) + 1;
+    memcpy(sb->strings + sb->string_size, s, len);
+    sb->string_size += (u32)len;
+    return pos;
+}
+
+static const sf_json_value* get_array(const sf_json_value* obj, const char* key) {
+    const sf_json_value* v = sf_json_get_field(obj, key);
+    return (v && v->type == SF_JSON_VAL_ARRAY) ? v : NULL;
+}
+
+static const char* get_string(const sf_json_value* obj, const char* key) {
+    const sf_json_value* v = sf_json_get_field(obj, key);
+    return (v && v->type == SF_JSON_VAL_STRING) ? v->as.s : NULL;
+}
+
+static bool name_equals(const char* a, const char* b) {
+    for (; *a && *b; ++a, ++b) {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) return false;
+    }
+    return *a == *b;
+}
+
+static u16 parse_resource_flags(const sf_json_value* flags) {
+    static const struct { const char* name; u16 flag; } table[] = {
+        { "ReadOnly",   SF_RESOURCE_FLAG_READONLY },
+        { "Persistent", SF_RESOURCE_FLAG_PERSISTENT },
+        { "Transient",  SF_RESOURCE_FLAG_TRANSIENT },
+        { "ScreenSize", SF_RESOURCE_FLAG_SCREEN_SIZE },
+        { "Output",     SF_RESOURCE_FLAG_OUTPUT },
+    };
+
+    u16 result = 0;
+    if (!flags || flags->type != SF_JSON_VAL_ARRAY) return 0;
+    for (size_t i = 0; i < flags->as.array.count; ++i) {
+        const sf_json_value* f = &flags->as.array.items[i];
+        if (f->type != SF_JSON_VAL_STRING) continue;
+        bool known = false;
+        for (size_t t = 0; t < sizeof(table) / sizeof(table[0]); ++t) {
+            if (name_equals(f->as.s, table[t].name)) {
+                result |= table[t].flag;
+                known = true;
+            }
+        }
+        if (!known) SF_LOG_WARN("Pipeline JSON: unknown resource flag '%s' (line %u)", f->as.s, f->loc.line);
+    }
+    return result;
+}
+
+static bool write_initial_data(const sf_json_value* data, sf_dtype dtype, u8* dst) {
+    for (size_t i = 0; i < data->as.array.count; ++i) {
+        const sf_json_value* v = &data->as.array.items[i];
+        if (v->type != SF_JSON_VAL_NUMBER && v->type != SF_JSON_VAL_BOOL) return false;
+        double n = v->type == SF_JSON_VAL_NUMBER ? v->as.n : (v->as.b ? 1.0 : 0.0);
+        switch (dtype) {
+            case SF_DTYPE_F32: { f32 x = (f32)n; memcpy(dst + i * sizeof(f32), &x, sizeof(f32)); break; }
+            case SF_DTYPE_I32: { i32 x = (i32)n; memcpy(dst + i * sizeof(i32), &x, sizeof(i32)); break; }
+            case SF_DTYPE_U8:  dst[i] = (u8)n; break;
+            default: return false;
+        }
+    }
+    return true;
+}
+
+bool sf_pipeline_from_json(sf_pipeline* pipe, const sf_json_value* root, sf_arena* arena) {
+    if (!pipe || !root || !arena) return false;
+    memset(pipe, 0, sizeof(sf_pipeline));
+
+    // Accept a whole app manifest as well as the bare pipeline object
+    const sf_json_value* nested = sf_json_get_field(root, "pipeline");
+    if (nested && nested->type == SF_JSON_VAL_OBJECT) root = nested;
+
+    const sf_json_value* resources = get_array(root, "resources");
+    const sf_json_value* kernels = get_array(root, "kernels");
+    u32 resource_count = resources ? (u32)resources->as.array.count : 0;
+    u32 kernel_count = kernels ? (u32)kernels->as.array.count : 0;
+
+    // 1. Size every table so each is a single arena allocation
+    size_t string_cap = 0;
+    u32 binding_count = 0;
+    for (u32 i = 0; i < resource_count; ++i) {
+        const char* name = get_string(&resources->as.array.items[i], "name");
+        string_cap += (name ? strlen(name) : 0) + 1;
+    }
+    for (u32 i = 0; i < kernel_count; ++i) {
+        const sf_json_value* k = &kernels->as.array.items[i];
+        const char* id = get_string(k, "id");
+        const char* entry = get_string(k, "entry");
+        string_cap += (id ? strlen(id) : 0) + (entry ? strlen(entry) : 0) + 2;
+        const sf_json_value* bindings = get_array(k, "bindings");
+        for (size_t b = 0; bindings && b < bindings->as.array.count; ++b) {
+            const char* port = get_string(&bindings->as.array.items[b], "port");
+            string_cap += (port ? strlen(port) : 0) + 1;
+            binding_count++;
+        }
+    }
+
+    sf_bin_pipeline_resource* out_res = SF_ARENA_PUSH(arena, sf_bin_pipeline_resource, resource_count);
+    sf_bin_pipeline_kernel* out_kernels = SF_ARENA_PUSH(arena, sf_bin_pipeline_kernel, kernel_count);
+    sf_bin_pipeline_binding* out_bindings = SF_ARENA_PUSH(arena, sf_bin_pipeline_binding, binding_count);
+    string_builder sb = { SF_ARENA_PUSH(arena, char, string_cap), 0 };
+    if (!out_res || !out_kernels || !out_bindings || !sb.strings) return false;
+    memset(out_res, 0, sizeof(sf_bin_pipeline_resource) * resource_count);
+
+    // 2. Resources (initial data is packed 16-byte aligned per resource)
+    u64 data_size = 0;
+    for (u32 i = 0; i < resource_count; ++i) {
+        const sf_json_value* r = &resources->as.array.items[i];
+        sf_bin_pipeline_resource* dst = &out_res[i];
+        const char* name = get_string(r, "name");
+        if (!name) {
+            SF_LOG_ERROR("Pipeline JSON: resource %u has no name (line %u)", i, r->loc.line);
+            return false;
+        }
+        dst->name = intern_string(&sb, name);
+        dst->dtype = (u8)sf_dtype_from_str(get_string(r, "dtype"));
+        dst->flags = parse_resource_flags(sf_json_get_field(r, "flags"));
+
+        const sf_json_value* shape = get_array(r, "shape");
+        if (shape && shape->as.array.count > SF_MAX_DIMS) {
+            SF_LOG_ERROR("Pipeline JSON: resource '%s' has rank %zu > %d (line %u)", name, shape->as.array.count, SF_MAX_DIMS, r->loc.line);
+            return false;
+        }
+        dst->ndim = shape ? (u8)shape->as.array.count : 0;
+        for (u8 d = 0; d < dst->ndim; ++d) {
+            const sf_json_value* dim = &shape->as.array.items[d];
+            dst->shape[d] = dim->type == SF_JSON_VAL_NUMBER ? (int32_t)dim->as.n : 0;
+        }
+
+        const sf_json_value* data = get_array(r, "data");
+        if (data) {
+            size_t count = sf_shape_calc_count(dst->shape, dst->ndim);
+            if (data->as.array.count != count) {
+                SF_LOG_ERROR("Pipeline JSON: resource '%s' has %zu values, shape needs %zu (line %u)", name, data->as.array.count, count, r->loc.line);
+                return false;
+            }
+            data_size = (data_size + 15) & ~(u64)15;
+            dst->data_offset = data_size;
+            dst->data_size = (u64)count * sf_dtype_size((sf_dtype)dst->dtype);
+            data_size += dst->data_size;
+        }
+    }
+
+    u8* out_data = SF_ARENA_PUSH(arena, u8, data_size);
+    if (!out_data) return false;
+    memset(out_data, 0, (size_t)data_size);
+    for (u32 i = 0; i < resource_count; ++i) {
+        const sf_json_value* data = get_array(&resources->as.array.items[i], "data");
+        if (data && !write_initial_data(data, (sf_dtype)out_res[i].dtype, out_data + out_res[i].data_offset)) {
+            SF_LOG_ERROR("Pipeline JSON: resource '%s' has non-numeric data", sb.strings + out_res[i].name);
+            return false;
+        }
+    }
+
+    // Resources are final, so lookups by name work while bindings are resolved
+    pipe->resources = out_res;
+    pipe->strings = sb.strings;
+    pipe->meta.resource_count = resource_count;
+    pipe->meta.string_size = sb.string_size;
+
+    // 3. Kernels and their bindings (resources are referenced by index)
+    u32 binding_cursor = 0;
+    for (u32 i = 0; i < kernel_count; ++i) {
+        const sf_json_value* k = &kernels->as.array.items[i];
+        sf_bin_pipeline_kernel* dst = &out_kernels[i];
+        const char* id = get_string(k, "id");
+        const char* entry = get_string(k, "entry");
+        if (!id || !entry) {
+            SF_LOG_ERROR("Pipeline JSON: kernel %u needs 'id' and 'entry' (line %u)", i, k->loc.line);
+            return false;
+        }
+        dst->id = intern_string(&sb, id);
+        dst->entry = intern_string(&sb, entry);
+        dst->binding_offset = binding_cursor;
+
+        const sf_json_value* bindings = get_array(k, "bindings");
+        for (size_t b = 0; bindings && b < bindings->as.array.count; ++b) {
+            const sf_json_value* bv = &bindings->as.array.items[b];
+            const char* port = get_string(bv, "port");
+            const char* resource = get_string(bv, "resource");
+            i32 res_idx = resource ? sf_pipeline_find_resource(pipe, resource) : -1;
+            if (!port || res_idx < 0) {
+                SF_LOG_ERROR("Pipeline JSON: kernel '%s' binds unknown resource '%s' (line %u)", id, resource ? resource : "?", bv->loc.line);
+                return false;
+            }
+            out_bindings[binding_cursor].port = intern_string(&sb, port);
+            out_bindings[binding_cursor].resource = (u32)res_idx;
+            binding_cursor++;
+        }
+        dst->binding_count = binding_cursor - dst->binding_offset;
+    }
+
+    pipe->kernels = out_kernels;
+    pipe->bindings = out_bindings;
+    pipe->strings = sb.strings;
+    pipe->data = out_data;
+    pipe->meta.kernel_count = kernel_count;
+    pipe->meta.binding_count = binding_cursor;
+    pipe->meta.string_size = sb.string_size;
+    pipe->meta.data_size = data_size;
+    return sf_pipeline_validate(pipe);
+}
@@ -0,0 +1,264 @@
+#include <sionflow/isa/sf_jit.h>
+#include <sionflow/isa/sf_opcodes.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// Runs a JIT kernel covering every opcode it supports and compares it with the scalar
+// definition of those opcodes (as in the fused reference evaluator) bit for bit.
+// Exits with SKIP_CODE where this build or CPU cannot run generated code.
+
+#define SKIP_CODE 77
+#define ELEMENT_COUNT 1027 // Not a multiple of the vector width: packed loop plus scalar tail
+
+enum {
+    REG_A, REG_B, REG_C,    // Contiguous inputs
+    REG_SCALAR,             // Unbound scalar, read as one value
+    REG_ROW,                // Bound with zero strides, read as one value
+    REG_T0, REG_T1, REG_T2, REG_T3, REG_T4, REG_T5, REG_T6, REG_T7, REG_T8, REG_T9,
+    REG_MID,                // Output that later instructions read back
+    REG_OUT,                // Domain output
+    REG_COUNT
+};
+
+static const sf_instruction CHAIN[] = {
+    { SF_OP_ADD,   REG_T0,  REG_A,   REG_SCALAR, 0, 0 },
+    { SF_OP_SUB,   REG_T1,  REG_B,   REG_A,      0, 0 },
+    { SF_OP_MUL,   REG_T2,  REG_T0,  REG_T1,     0, 0 },
+    { SF_OP_DIV,   REG_T3,  REG_T2,  REG_C,      0, 0 },
+    { SF_OP_MIN,   REG_T4,  REG_T3,  REG_B,      0, 0 },
+    { SF_OP_MAX,   REG_T5,  REG_T4,  REG_ROW,    0, 0 },
+    { SF_OP_ABS,   REG_T6,  REG_T1,  0,          0, 0 },
+    { SF_OP_SQRT,  REG_T7,  REG_T3,  0,          0, 0 },
+    { SF_OP_FMA,   REG_MID, REG_T7,  REG_T5,     REG_T6, 0 },
+    { SF_OP_CLAMP, REG_T8,  REG_MID, REG_SCALAR, REG_C,  0 },
+    { SF_OP_MIX,   REG_T9,  REG_A,   REG_T8,     REG_C,  0 },
+    { SF_OP_STEP,  REG_T0,  REG_T9,  REG_MID,    0, 0 },
+    { SF_OP_FMA,   REG_OUT, REG_T0,  REG_MID,    REG_T9, 0 },
+};
+#define CHAIN_LENGTH (sizeof(CHAIN) / sizeof(CHAIN[0]))
+
+static const u16 SUPPORTED[] = {
+    SF_OP_ADD, SF_OP_SUB, SF_OP_MUL, SF_OP_DIV, SF_OP_MIN, SF_OP_MAX,
+    SF_OP_ABS, SF_OP_SQRT, SF_OP_FMA, SF_OP_CLAMP, SF_OP_MIX, SF_OP_STEP,
+};
+
+// Inputs the loop must not treat differently from the tail
+static const f32 SPECIALS[] = {
+    0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -2.5f, 1e-40f, -1e-40f, 3.4e38f, -3.4e38f, INFINITY, -INFINITY, NAN,
+};
+
+static f32 g_data[REG_COUNT][ELEMENT_COUNT + 1]; // One guard element past the tile
+
+static f32 eval_scalar(u16 opcode, f32 a, f32 b, f32 c) {
+    switch (opcode) {
+        case SF_OP_ADD:   return a + b;
+        case SF_OP_SUB:   return a - b;
+        case SF_OP_MUL:   return a * b;
+        case SF_OP_DIV:   return a / b;
+        case SF_OP_MIN:   return a < b ? a : b;
+        case SF_OP_MAX:   return a > b ? a : b;
+        case SF_OP_ABS:   return fabsf(a);
+        case SF_OP_SQRT:  return sqrtf(a);
+        case SF_OP_FMA:   return a * b + c;
+        case SF_OP_CLAMP: { f32 v = a > b ? a : b; return v < c ? v : c; }
+        case SF_OP_MIX:   return a + (b - a) * c;
+        case SF_OP_STEP:  return a <= b ? 1.0f : 0.0f;
+        default:          return NAN;
+    }
+}
+
+static u32 bits(f32 v) {
+    u32 u;
+    memcpy(&u, &v, sizeof(u));
+    return u;
+}
+
+// NaN payloads depend on which operand the compiler puts first, so any NaN matches any NaN
+static bool same_bits(f32 x, f32 y) {
+    return bits(x) == bits(y) || (isnan(x) && isnan(y));
+}
+
+static u32 g_rng = 0x12345678u;
+static u32 next_random(void) {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return g_rng;
+}
+
+static void fill_inputs(void) {
+    const u32 special_count = (u32)(sizeof(SPECIALS) / sizeof(SPECIALS[0]));
+    for (int r = REG_A; r <= REG_C; ++r) {
+        for (u32 i = 0; i < ELEMENT_COUNT; ++i) {
+            u32 pick = next_random();
+            g_data[r][i] = pick % 8 == 0 ? SPECIALS[(pick >> 8) % special_count]
+                                         : (f32)((i32)(pick >> 8) % 20000 - 10000) / 97.0f;
+        }
+    }
+}
+
+static void setup_program(sf_program* prog, sf_task* task, sf_type_info* infos, sf_bin_task_binding* bindings, u32* binding_count) {
+    memset(infos, 0, sizeof(sf_type_info) * REG_COUNT);
+    *binding_count = 0;
+    for (u16 r = 0; r < REG_COUNT; ++r) {
+        infos[r].dtype = SF_DTYPE_F32;
+        infos[r].ndim = r == REG_SCALAR ? 0 : 1;
+        infos[r].shape[0] = r == REG_SCALAR ? 0 : ELEMENT_COUNT;
+        if (r == REG_SCALAR) continue;
+
+        sf_bin_task_binding* b = &bindings[(*binding_count)++];
+        memset(b, 0, sizeof(*b));
+        b->reg_idx = r;
+        b->strides[0] = r == REG_ROW ? 0 : (i32)sizeof(f32);
+        b->flags = (r == REG_MID || r == REG_OUT) ? SF_BINDING_FLAG_WRITE : SF_BINDING_FLAG_READ;
+    }
+
+    memset(prog, 0, sizeof(*prog));
+    prog->meta.tensor_count = REG_COUNT;
+    prog->meta.instruction_count = (u32)CHAIN_LENGTH;
+    prog->meta.binding_count = *binding_count;
+    prog->tensor_infos = infos;
+    prog->bindings = bindings;
+    prog->code = (sf_instruction*)CHAIN;
+
+    memset(task, 0, sizeof(*task));
+    task->inst_count = (u32)CHAIN_LENGTH;
+    task->binding_count = *binding_count;
+    task->domain_reg = REG_OUT;
+}
+
+static int check_coverage(void) {
+    int failures = 0;
+    for (size_t k = 0; k < sizeof(SUPPORTED) / sizeof(SUPPORTED[0]); ++k) {
+        bool found = false;
+        for (size_t i = 0; i < CHAIN_LENGTH; ++i) found |= CHAIN[i].opcode == SUPPORTED[k];
+        if (!found) {
+            printf("FAIL: chain does not use opcode %u\n", SUPPORTED[k]);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+static int run_count(const sf_jit_kernel* kernel, u32 count, f32 scalar, f32 row) {
+    static _Alignas(16) u8 reg_memory[4096];
+    if (sf_exec_ctx_calc_registers_size(REG_COUNT) > sizeof(reg_memory)) {
+        printf("FAIL: register tables do not fit the test buffer\n");
+        return 1;
+    }
+
+    g_data[REG_SCALAR][0] = scalar;
+    g_data[REG_ROW][0] = row;
+    const f32 guard = -1234.5f;
+    for (int r = REG_T0; r < REG_COUNT; ++r) {
+        for (u32 i = 0; i <= ELEMENT_COUNT; ++i) g_data[r][i] = guard;
+    }
+
+    sf_exec_ctx ctx;
+    sf_exec_ctx_init(&ctx, NULL);
+    sf_exec_ctx_bind_registers(&ctx, reg_memory, REG_COUNT);
+    for (int r = 0; r < REG_COUNT; ++r) ctx.reg_ptrs[r] = g_data[r];
+    ctx.batch_size = count;
+    sf_jit_kernel_run(kernel, &ctx);
+
+    int failures = 0;
+    for (u32 e = 0; e < count; ++e) {
+        f32 v[REG_COUNT];
+        for (int r = 0; r < REG_COUNT; ++r) v[r] = g_data[r][e];
+        v[REG_SCALAR] = scalar;
+        v[REG_ROW] = row;
+        for (size_t i = 0; i < CHAIN_LENGTH; ++i) {
+            const sf_instruction* inst = &CHAIN[i];
+            v[inst->dest_idx] = eval_scalar(inst->opcode, v[inst->src1_idx], v[inst->src2_idx], v[inst->src3_idx]);
+        }
+
+        const int outputs[] = { REG_MID, REG_OUT };
+        for (int k = 0; k < 2; ++k) {
+            f32 got = g_data[outputs[k]][e];
+            if (!same_bits(got, v[outputs[k]])) {
+                if (failures < 8) {
+                    printf("FAIL: count %u, reg %d, element %u: 0x%08x, expected 0x%08x\n",
+                           count, outputs[k], e, bits(got), bits(v[outputs[k]]));
+                }
+                failures++;
+            }
+        }
+    }
+
+    // Outputs stop at the tile; temporaries never reach memory
+    for (int r = REG_T0; r < REG_COUNT; ++r) {
+        bool output = r == REG_MID || r == REG_OUT;
+        for (u32 i = output ? count : 0; i <= ELEMENT_COUNT; ++i) {
+            if (bits(g_data[r][i]) != bits(guard)) {
+                if (failures < 8) printf("FAIL: count %u, reg %d, element %u written\n", count, r, i);
+                failures++;
+                break;
+            }
+        }
+    }
+    return failures;
+}
+
+int main(void) {
+    if (!sf_jit_available()) {
+        printf("SKIP: JIT not available on this build/CPU\n");
+        return SKIP_CODE;
+    }
+
+    int failures = check_coverage();
+
+    sf_type_info infos[REG_COUNT];
+    sf_bin_task_binding bindings[REG_COUNT];
+    u32 binding_count;
+    sf_program prog;
+    sf_task task;
+    setup_program(&prog, &task, infos, bindings, &binding_count);
+
+    sf_jit_cache* cache = sf_jit_cache_create();
+    if (!cache) {
+        printf("FAIL: cache creation\n");
+        return 1;
+    }
+
+    const sf_jit_kernel* kernel = sf_jit_compile_task(cache, &prog, &task);
+    if (!kernel) {
+        printf("FAIL: chain did not compile\n");
+        sf_jit_cache_destroy(cache);
+        return 1;
+    }
+
+    fill_inputs();
+    const u32 counts[] = { 0, 1, 3, 4, 5, 7, 8, ELEMENT_COUNT };
+    const f32 scalars[][2] = { { 0.37f, -0.0f }, { -1.5f, 2.0f }, { NAN, INFINITY } };
+    for (size_t s = 0; s < sizeof(scalars) / sizeof(scalars[0]); ++s) {
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+            failures += run_count(kernel, counts[c], scalars[s][0], scalars[s][1]);
+        }
+    }
+
+    // Same chain again, then from a separate program with equal contents
+    if (sf_jit_compile_task(cache, &prog, &task) != kernel) {
+        printf("FAIL: second compile missed the cache\n");
+        failures++;
+    }
+    sf_instruction copy[CHAIN_LENGTH];
+    memcpy(copy, CHAIN, sizeof(copy));
+    sf_program other = prog;
+    other.code = copy;
+    if (sf_jit_compile_task(cache, &other, &task) != kernel) {
+        printf("FAIL: identical chain from another program missed the cache\n");
+        failures++;
+    }
+
+    size_t code_size = kernel->code_size;
+    sf_jit_cache_destroy(cache);
+
+    if (failures) {
+        printf("%d failure(s)\n", failures);
+        return 1;
+    }
+    printf("OK: %u opcodes, %u elements, kernel %zu bytes\n",
+           (u32)(sizeof(SUPPORTED) / sizeof(SUPPORTED[0])), ELEMENT_COUNT, code_size);
+    return 0;
+}
@@ -62,8 +62,17 @@ def main():
         with open(args.layout, "r") as f:
             layout_data = json.load(f)
             
+    # 4.6 Opcode values must be unique (they index the direct lookup table)
+    opcode_by_value = {}
+    for opcode_name, value in isa_data["opcodes"].items():
+        if value in opcode_by_value:
+            print(f"Error: opcodes {opcode_by_value[value]} and {opcode_name} share the value {value}")
+            sys.exit(1)
+        opcode_by_value[value] = opcode_name
+
     # 5. Prepare Context
     meta_by_opcode = {}
+    node_by_opcode = {} # Real opcode -> owning node id (feeds the direct-indexed lookup table)
     nodes_by_id = {n["id"]: n for n in isa_data["nodes"]}
     
     # Pre-calculate type masks as bitfields
@@ -114,6 +123,13 @@ def main():
         # meta_by_opcode should only contain entries for actual bytecode instructions
         if not is_virtual:
             meta_by_opcode[opcode_name] = meta
+
+        # NOOP is shared by every node that lowers to nothing and is never looked up
+        if not is_virtual and opcode_name != "NOOP":
+            if opcode_name in node_by_opcode:
+                print(f"Error: opcode {opcode_name} is claimed by both {node_by_opcode[opcode_name]} and {node['id']}")
+                sys.exit(1)
+            node_by_opcode[opcode_name] = node["id"]
         
         # Add a special field to node for templates to check
         node["is_virtual"] = is_virtual
@@ -129,6 +145,7 @@ def main():
         "constants": isa_data["constants"],
         "nodes_by_id": nodes_by_id,
         "meta_by_opcode": meta_by_opcode,
+        "node_by_opcode": sorted(node_by_opcode.items(), key=lambda kv: isa_data["opcodes"][kv[0]]),
         "implementations": backend_data.get("implementations", {}),
         "compiler": compiler_data,
         "manifest": manifest_data.get("manifest", {}),